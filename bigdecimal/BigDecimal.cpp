@@ -11,9 +11,11 @@
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
+#include "biginteger/algorithms/division/ConstantDivision.h"
 #include "biginteger/common/Builder.h"
 #include "biginteger/common/Parser.h"
 #include "biginteger/ops/Operations.h"
@@ -43,10 +45,9 @@ namespace BigMath
 
     // 10^n as BigInteger. n must be >= 0.
     //
-    // The underlying Pow10(d) returns a thread-local cached vector<DataT>; we
-    // additionally cache the BigInteger wrapper here so repeated Multiply/Add
-    // calls at the same scale don't pay for the vector copy + sign assignment
-    // every time. Wrappers reference the same cached value vector.
+    // Pow strips the factor 2^n into a shift and raises 5 by squaring with
+    // scalar multiplies. Results are cached per thread so repeated
+    // Multiply/Add calls at the same scale reuse one value.
     BigInteger const &Pow10Bi(int n)
     {
       if (n < 0)
@@ -54,10 +55,40 @@ namespace BigMath
       static thread_local std::unordered_map<int, BigInteger> cache;
       auto it = cache.find(n);
       if (it != cache.end()) return it->second;
-      BigInteger v = (n == 0) ? BIOne() : BigInteger(Pow10((SizeT)n), false);
+      BigInteger v = Pow(BITen(), (ULong)n);
       return cache.emplace(n, std::move(v)).first->second;
     }
 
+    // 10^k for k ≤ 19, the powers that fit a ConstantDivider.
+    constexpr ULong Pow10Limb(int k)
+    {
+      ULong p = 1;
+      while (k-- > 0)
+        p *= 10;
+      return p;
+    }
+
+    // f(ConstantDivider<10^k>{}) for 1 ≤ k ≤ 19.
+    template <int K = 1, class F>
+    decltype(auto) WithPow10Divider(int k, F &&f)
+    {
+      if constexpr (K < 19)
+      {
+        if (k != K)
+          return WithPow10Divider<K + 1>(k, f);
+      }
+      return f(ConstantDivider<Pow10Limb(K)>{});
+    }
+
+    // x as a non-negative BigInteger in either limb layout.
+    BigInteger FromULong(ULong x)
+    {
+      std::vector<DataT> v{(DataT)(x & LimbMask)};
+      if constexpr (LimbBits < 64)
+        v.push_back((DataT)(x >> LimbBits));
+      return BigInteger(v, false);
+    }
+
     // True ⇔ rounded result magnitude should increase by 1 (away from zero).
     // `r` and `den` are non-negative magnitudes; `q` is the truncated quotient
     // magnitude. `resultNeg` is the sign of the *final* signed quotient.
@@ -326,8 +357,19 @@ namespace BigMath
     int drop = scale_ - newScale;
     BigInteger divisor = Pow10Bi(drop);
     bool resultNeg = unscaled_.IsNegative();
-    BigInteger absU = AbsCopy(unscaled_);
-    auto [q, r] = DivideAndRemainder(absU, divisor);
+    BigInteger q, r;
+    if (drop <= 19)
+    {
+      // Short drops divide by a constant 10^drop in one pass.
+      std::vector<DataT> u = unscaled_.GetInteger();
+      ULong rem = WithPow10Divider(drop, [&](auto d) { return decltype(d)::DivModTo(u); });
+      q = BigInteger(u, false);
+      r = FromULong(rem);
+    }
+    else
+    {
+      std::tie(q, r) = DivideAndRemainder(AbsCopy(unscaled_), divisor);
+    }
     if (RoundAwayFromZero(r, divisor, q, mode, resultNeg))
       q = q + BIOne();
     BigInteger signed_q = q;
@@ -339,17 +381,27 @@ namespace BigMath
   BigDecimal BigDecimal::StripTrailingZeros() const
   {
     if (unscaled_.Zero()) return BigDecimal(BIZero(), 0);
-    BigInteger u = unscaled_;
+    std::vector<DataT> u = unscaled_.GetInteger();
     int s = scale_;
-    BigInteger ten = BITen();
+    // Up to eighteen zeros per round: the low digits come from one constant
+    // remainder (10^18 still takes the four-limb fold), and the zeros found
+    // are divided out exactly from the low end.
     while (s > 0)
     {
-      auto [q, r] = DivideAndRemainder(u, ten);
-      if (!r.Zero()) break;
-      u = q;
-      --s;
+      int m = std::min(s, 18);
+      ULong r = ConstantDivider<Pow10Limb(18)>::Mod(u);
+      int zeros = 0;
+      while (zeros < m && r % 10 == 0)
+      {
+        r /= 10;
+        ++zeros;
+      }
+      if (zeros == 0) break;
+      WithPow10Divider(zeros, [&](auto d) { decltype(d)::DivideExactTo(u); });
+      s -= zeros;
+      if (zeros < m) break;
     }
-    return BigDecimal(std::move(u), s);
+    return BigDecimal(BigInteger(u, unscaled_.IsNegative()), s);
   }
 
   // ── comparison ────────────────────────────────────────────────────────────
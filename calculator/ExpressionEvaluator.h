@@ -6,13 +6,15 @@
  *   summands := factors  ( ( '+' | '-' ) factors )*
  *   factors  := power    ( ( '*' | '/' | '%' ) power )*
  *   power    := unary    ( '^' power )?          // right-associative
- *   unary    := ( '+' | '-' ) unary | atom
+ *   unary    := ( '+' | '-' ) unary | postfix
+ *   postfix  := atom ( '!' )*
  *   atom     := number | identifier | '(' summands ')'
  *
  * Variables: lookup function passed in via constructor. Unknown identifiers
  * raise EvalError with the source position.
  *
- * Operators: +, -, *, /, %, ^   (^ is integer exponent; non-negative).
+ * Operators: +, -, *, /, %, ^   (^ is integer exponent; non-negative),
+ * and postfix ! (factorial; -3! == -(3!)).
  * Whitespace skipped between tokens. '#' to end of line is a comment.
  *
  * S. M. Mahbub Murshed (murshed@gmail.com)
@@ -162,7 +164,20 @@ namespace BigMath
           -x;  // in-place negate
         return x;
       }
-      return ParseAtom();
+      return ParsePostfix();
+    }
+
+    BigInteger ParsePostfix()
+    {
+      BigInteger x = ParseAtom();
+      while (true)
+      {
+        SkipSpaces();
+        if (*cur_ != '!')
+          return x;
+        x = Factorial(x);
+        ++cur_;
+      }
     }
 
     BigInteger ParseAtom()
@@ -182,8 +197,8 @@ namespace BigMath
 
       if (*cur_ >= '0' && *cur_ <= '9')
       {
-        // Hex (0x...) and binary (0b...) literals: parsed via repeated
-        // multiply-and-add since the library only natively parses decimal.
+        // Hex (0x...) and binary (0b...) literals: digits are packed into
+        // limbs directly.
         if (*cur_ == '0' && (cur_[1] == 'x' || cur_[1] == 'X'))
         {
           cur_ += 2;
@@ -245,9 +260,7 @@ namespace BigMath
     BigInteger ParseRadixLiteral(int radix)
     {
       char const *start = cur_;
-      BigInteger result = BigIntegerBuilder::From("0");
-      BigInteger base = BigIntegerBuilder::From(std::to_string(radix));
-      int digits = 0;
+      std::string digits;
       while (true)
       {
         char c = *cur_;
@@ -261,16 +274,15 @@ namespace BigMath
         {
           Fail(std::string("digit '") + c + "' out of range for base " + std::to_string(radix));
         }
-        result = result * base + BigIntegerBuilder::From(std::to_string(d));
+        digits.push_back(c);
         ++cur_;
-        ++digits;
       }
-      if (digits == 0)
+      if (digits.empty())
       {
         cur_ = start;
         Fail(std::string("expected ") + (radix == 16 ? "hex" : "binary") + " digits");
       }
-      return result;
+      return BigInteger(ParseUnsignedPow2(digits.c_str(), 0, (Int)digits.size() - 1, (SizeT)radix), false);
     }
 
     static bool IsIdentifierStart(char c)
@@ -282,8 +294,19 @@ namespace BigMath
       return IsIdentifierStart(c) || (c >= '0' && c <= '9');
     }
 
-    // ── integer power: square-and-multiply, exponent must be non-negative ────
-    BigInteger Pow(BigInteger base, BigInteger exp)
+    // ── factorial: n must be non-negative ───────────────────────────────────
+    BigInteger Factorial(BigInteger const &n)
+    {
+      if (n.IsNegative())
+        Fail("Factorial of a negative number");
+      // 2·10^7! already has about 1.4·10^8 digits.
+      if (n.size() > 1 || n[0] > (DataT)20000000)
+        Fail("Argument too large for factorial");
+      return BigMath::Factorial((ULong)n[0]);
+    }
+
+    // ── integer power: exponent must be non-negative ─────────────────────────
+    BigInteger Pow(BigInteger const &base, BigInteger const &exp)
     {
       if (exp.IsNegative())
         Fail("Negative exponent not supported for integer power");
@@ -292,26 +315,16 @@ namespace BigMath
         // 0^0 conventionally = 1.
         return BigIntegerBuilder::From("1");
       }
-      if (base.Zero())
-        return BigIntegerBuilder::From("0");
+      // 0, 1 and -1 stay small whatever the exponent.
+      if (base.Zero() || (base.size() == 1 && base[0] == 1))
+        return BigMath::Pow(base, (exp[0] & 1) ? 1 : 2);
 
-      // Reject absurd exponents that would never fit in memory (>= 2^32 bits
-      // would already be terabytes-scale).
-      if (exp.size() > 1 || exp[0] > (DataT)20000000)
+      // Reject results that would never fit in memory: ~2^33 bits is
+      // already a gigabyte.
+      ULong baseBits = (ULong)base.size() * LimbBits;
+      if (exp.size() > 1 || exp[0] > ((ULong)1 << 33) / baseBits)
         Fail("Exponent too large for integer power");
-
-      uint32_t e = (uint32_t)exp[0];
-      BigInteger result = BigIntegerBuilder::From("1");
-      BigInteger b = base;
-      while (e > 0)
-      {
-        if (e & 1u)
-          result = result * b;
-        e >>= 1;
-        if (e > 0)
-          b = b * b;
-      }
-      return result;
+      return BigMath::Pow(base, (ULong)exp[0]);
     }
   };
 }
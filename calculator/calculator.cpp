@@ -49,47 +49,13 @@ namespace
 
   // ─── output formatting ──────────────────────────────────────────────────────
 
-  std::string FormatHex(BigInteger const &x)
+  // Sign, base prefix, then the digits from the linear power-of-two formatter.
+  std::string FormatRadix(BigInteger const &x, char const *prefix, SizeT radix)
   {
     std::string out;
     if (x.IsNegative()) out.push_back('-');
-    out += "0x";
-    auto const &v = x.GetInteger();
-    int hi = (int)v.size() - 1;
-    while (hi > 0 && v[hi] == 0) --hi;
-    char buf[16];
-    std::snprintf(buf, sizeof(buf), "%x", (unsigned)v[hi]);
-    out += buf;
-    for (int i = hi - 1; i >= 0; --i)
-    {
-      std::snprintf(buf, sizeof(buf), "%08x", (unsigned)v[i]);
-      out += buf;
-    }
-    return out;
-  }
-
-  std::string FormatBin(BigInteger const &x)
-  {
-    std::string out;
-    if (x.IsNegative()) out.push_back('-');
-    out += "0b";
-    auto const &v = x.GetInteger();
-    int hi = (int)v.size() - 1;
-    while (hi > 0 && v[hi] == 0) --hi;
-
-    auto pushBits = [&](uint32_t w, int bits) {
-      for (int i = bits - 1; i >= 0; --i)
-        out.push_back(((w >> i) & 1u) ? '1' : '0');
-    };
-
-    // Top limb: strip leading zero bits (but keep at least one).
-    uint32_t top = (uint32_t)v[hi];
-    int topBits = 32;
-    while (topBits > 1 && ((top >> (topBits - 1)) & 1u) == 0)
-      --topBits;
-    pushBits(top, topBits);
-    for (int i = hi - 1; i >= 0; --i)
-      pushBits((uint32_t)v[i], 32);
+    out += prefix;
+    out += ToStringPow2(x.GetInteger(), radix);
     return out;
   }
 
@@ -121,8 +87,8 @@ namespace
     std::string raw;
     switch (s.base)
     {
-      case 16: raw = FormatHex(x); break;
-      case 2:  raw = FormatBin(x); break;
+      case 16: raw = FormatRadix(x, "0x", 16); break;
+      case 2:  raw = FormatRadix(x, "0b", 2);  break;
       default: raw = ToString(x);  break;
     }
     return MaybeTruncate(std::move(raw), s.maxDigits);
@@ -191,6 +157,7 @@ namespace
         "Expressions:\n"
         "  + - * / %                arithmetic (integer)\n"
         "  ^                        exponent (right-assoc, non-negative)\n"
+        "  n!                       factorial\n"
         "  ( )                      grouping\n"
         "  unary + -                e.g. -(-5) == 5\n"
         "  123_456_789              underscore digit separators\n"
@@ -5,6 +5,11 @@
  * common/Parser.h instead, which uses the optimized D&C path with cached
  * powers of 10.
  *
+ * Between two power-of-two bases (Base2_64 included) the digits are
+ * repacked bit by bit in one pass. Between the limb base and a radix from
+ * 2 to 62 the conversion goes through ParseRadix / ToStringRadix, which is
+ * subquadratic. Other pairs run the quadratic multiply-and-add.
+ *
  * S. M. Mahbub Murshed (murshed@gmail.com)
  */
 
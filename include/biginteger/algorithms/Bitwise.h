@@ -0,0 +1,194 @@
+/**
+ * BigMath: limb kernels for bitwise operations.
+ *
+ * Two's complement is produced on the fly from sign-magnitude. For a
+ * magnitude m whose lowest non-zero limb is z, the n-limb two's
+ * complement of −m is
+ *
+ *   limb i < z:  0
+ *   limb z:      −m[z]  (mod B)
+ *   limb i > z:  ~m[i]  (B − 1 above the magnitude)
+ *
+ * and the same transform maps a negative n-limb value back to its
+ * magnitude. Everything else is limbwise with no carries.
+ *
+ * The kernels step 4 limbs at a time with AVX2. PopCount uses VPOPCNTQ
+ * over 8 limbs with AVX-512 VPOPCNTDQ, otherwise the AVX2 nibble lookup
+ * (Mula): GCC only vectorizes the popcount loop itself when VPOPCNTDQ is
+ * available, and none of the loops below -O3.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BITWISE
+#define BITWISE
+
+#include <vector>
+
+#include "../common/Util.h"
+
+// Set -DBIGMATH_BITWISE_SIMD=0 for the plain limb loops (A/B comparison).
+#ifndef BIGMATH_BITWISE_SIMD
+#define BIGMATH_BITWISE_SIMD 1
+#endif
+
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace BigMath
+{
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+  inline __m256i LoadLimbs(DataT const *p)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+  }
+
+  inline void StoreLimbs(DataT *p, __m256i v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+#endif
+
+  // v ← ~v over n limbs.
+  inline void NotTo(DataT *v, SizeT n)
+  {
+    SizeT i = 0;
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+    __m256i mask = _mm256_set1_epi64x((long long)LimbMask);
+    for (; i + 4 <= n; i += 4)
+      StoreLimbs(v + i, _mm256_xor_si256(LoadLimbs(v + i), mask));
+#endif
+    for (; i < n; ++i)
+      v[i] = ~v[i] & LimbMask;
+  }
+
+  // v ← −v mod B^n.
+  inline void NegateTo(DataT *v, SizeT n)
+  {
+    SizeT z = 0;
+    while (z < n && v[z] == 0)
+      ++z;
+    if (z == n)
+      return;
+    v[z] = (0 - v[z]) & LimbMask;
+    NotTo(v + z + 1, n - z - 1);
+  }
+
+  inline void AndTo(DataT *r, DataT const *a, SizeT n)
+  {
+    SizeT i = 0;
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+    for (; i + 4 <= n; i += 4)
+      StoreLimbs(r + i, _mm256_and_si256(LoadLimbs(r + i), LoadLimbs(a + i)));
+#endif
+    for (; i < n; ++i)
+      r[i] &= a[i];
+  }
+
+  inline void OrTo(DataT *r, DataT const *a, SizeT n)
+  {
+    SizeT i = 0;
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+    for (; i + 4 <= n; i += 4)
+      StoreLimbs(r + i, _mm256_or_si256(LoadLimbs(r + i), LoadLimbs(a + i)));
+#endif
+    for (; i < n; ++i)
+      r[i] |= a[i];
+  }
+
+  inline void XorTo(DataT *r, DataT const *a, SizeT n)
+  {
+    SizeT i = 0;
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+    for (; i + 4 <= n; i += 4)
+      StoreLimbs(r + i, _mm256_xor_si256(LoadLimbs(r + i), LoadLimbs(a + i)));
+#endif
+    for (; i < n; ++i)
+      r[i] ^= a[i];
+  }
+
+#if BIGMATH_BITWISE_SIMD && defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+  // Set bits of a (of a ^ b with Xor) over the leading multiple of 8 limbs;
+  // i is left at the first limb not counted.
+  template <bool Xor>
+  inline ULong PopCountBlocks(DataT const *a, DataT const *b, SizeT n, SizeT &i)
+  {
+    __m512i acc = _mm512_setzero_si512();
+    for (; i + 8 <= n; i += 8)
+    {
+      __m512i v = _mm512_loadu_si512(a + i);
+      if constexpr (Xor)
+        v = _mm512_xor_si512(v, _mm512_loadu_si512(b + i));
+      acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    // Store-and-add rather than _mm512_reduce_add_epi64: GCC's expansion of
+    // the latter through _mm512_extracti64x4_epi64 trips -Wmaybe-uninitialized.
+    alignas(64) ULong lanes[8];
+    _mm512_store_si512(lanes, acc);
+    ULong count = 0;
+    for (SizeT j = 0; j < 8; ++j)
+      count += lanes[j];
+    return count;
+  }
+#elif BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+  // As above over multiples of 4 limbs: per-nibble counts from a shuffle
+  // table, summed per 64-bit lane by VPSADBW.
+  template <bool Xor>
+  inline ULong PopCountBlocks(DataT const *a, DataT const *b, SizeT n, SizeT &i)
+  {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 4 <= n; i += 4)
+    {
+      __m256i v = LoadLimbs(a + i);
+      if constexpr (Xor)
+        v = _mm256_xor_si256(v, LoadLimbs(b + i));
+      __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble));
+      __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+      acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    alignas(32) ULong lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  }
+#endif
+
+  inline ULong PopCount(DataT const *a, SizeT n)
+  {
+    ULong count = 0;
+    SizeT i = 0;
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+    count = PopCountBlocks<false>(a, nullptr, n, i);
+#endif
+    for (; i < n; ++i)
+      count += (ULong)__builtin_popcountll((ULong)a[i]);
+    return count;
+  }
+
+  // Number of set bits in a ^ b over n limbs.
+  inline ULong XorPopCount(DataT const *a, DataT const *b, SizeT n)
+  {
+    ULong count = 0;
+    SizeT i = 0;
+#if BIGMATH_BITWISE_SIMD && defined(__AVX2__)
+    count = PopCountBlocks<true>(a, b, n, i);
+#endif
+    for (; i < n; ++i)
+      count += (ULong)__builtin_popcountll((ULong)(a[i] ^ b[i]));
+    return count;
+  }
+
+  // Index of the lowest set bit of a non-zero v.
+  inline ULong TrailingZeroBits(std::vector<DataT> const &v)
+  {
+    SizeT i = 0;
+    while (v[i] == 0)
+      ++i;
+    return (ULong)i * LimbBits + (ULong)__builtin_ctzll((ULong)v[i]);
+  }
+}
+
+#endif
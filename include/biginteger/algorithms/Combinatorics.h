@@ -0,0 +1,32 @@
+/**
+ * BigMath: combinatorial functions
+ *
+ *   - Factorial, Binomial, Primorial → PrimeSwing (sieve, prime-swing
+ *     recursion and balanced product trees)
+ *
+ * Binary limb bases only (Base2_32 / Base2_64).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef COMBINATORICS
+#define COMBINATORICS
+
+#include <vector>
+
+#include "../common/Util.h"
+#include "combinatorics/PrimeSwing.h"
+
+namespace BigMath
+{
+  // n!.
+  std::vector<DataT> Factorial(ULong n, BaseT base);
+
+  // C(n, k); zero for k > n.
+  std::vector<DataT> Binomial(ULong n, ULong k, BaseT base);
+
+  // Product of the primes p ≤ n.
+  std::vector<DataT> Primorial(ULong n, BaseT base);
+}
+
+#endif
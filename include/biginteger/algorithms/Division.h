@@ -10,6 +10,11 @@
  *      → FastDivision        (Knuth Algorithm D, hybrid-64-bit basecase)
  *   4. single-limb divisor inside the above → ClassicDivision
  *
+ * Remainder runs the same bands with the quotient left unassembled.
+ * DivisionMode::Latency lets one BZ or Newton division fork its block work
+ * across the thread pool; Throughput (default) keeps it on the caller.
+ * DivExact (b known to divide a) goes to ExactDivision instead.
+ *
  * Thresholds tunable at compile time via -DBIGMATH_*=N.
  *
  * S. M. Mahbub Murshed (murshed@gmail.com)
@@ -24,6 +29,7 @@
 #include "../BigInteger.h"
 #include "division/BurnikelZieglerDivision.h"
 #include "division/ClassicDivision.h"
+#include "division/ExactDivision.h"
 #include "division/FastDivision.h"
 #include "division/NewtonDivision.h"
 
@@ -57,6 +63,26 @@ namespace BigMath
 #define BIGMATH_NEWTON_HIGH_SKEW_DENOMINATOR 1
 #endif
 
+  // How one large division uses the thread pool. Throughput keeps each
+  // division on its calling thread, apart from the NTT's own batches, and
+  // leaves the other cores to concurrent callers. Latency also runs BZ's
+  // q̂·b₀ products in slices and Newton's quotient segments across the pool,
+  // for extra total work. Process-wide; set it before dividing.
+  enum class DivisionMode
+  {
+    Throughput,
+    Latency
+  };
+
+  void SetDivisionMode(DivisionMode mode);
+  DivisionMode GetDivisionMode();
+
+  // Threads a Latency division plans its slices and segments for; 0 (the
+  // default) means ParallelNumThreads(). A test hook: a nonzero count runs
+  // the split paths even on a one-thread pool, where the pool does the
+  // pieces one after another.
+  void SetDivisionWorkers(SizeT workers);
+
   extern const SizeT NEWTON_MEDIUM_B;
   extern const SizeT BZ_DIVISOR_THRESHOLD;
   extern const SizeT NEWTON_SKEW_NUMERATOR;
@@ -83,6 +109,27 @@ namespace BigMath
   std::vector<DataT> Divide(std::vector<DataT> const &a,
                             DataT b,
                             BaseT base);
+
+  // a mod b without forming the quotient.
+  std::vector<DataT> Remainder(std::vector<DataT> const &a,
+                               std::vector<DataT> const &b,
+                               BaseT base);
+
+  DataT Remainder(std::vector<DataT> const &a,
+                  DataT b,
+                  BaseT base);
+
+  // Whether b divides a. Single-limb divisors take one remainder pass;
+  // longer ones are screened by powers of two, then checked through the
+  // exact quotient.
+  bool IsDivisibleBy(std::vector<DataT> const &a,
+                     std::vector<DataT> const &b,
+                     BaseT base);
+
+  // a / b for b dividing a; the result is unspecified otherwise.
+  std::vector<DataT> DivExact(std::vector<DataT> const &a,
+                              std::vector<DataT> const &b,
+                              BaseT base);
 }
 
 #endif
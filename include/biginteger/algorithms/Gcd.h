@@ -0,0 +1,43 @@
+/**
+ * BigMath: GCD dispatcher
+ *
+ *   - b fits one limb                    → one scalar remainder + binary GCD
+ *   - a.size() < GCD_HGCD_THRESHOLD       → LehmerGcd
+ *   - otherwise                           → HalfGcd (subquadratic)
+ *
+ * Thresholds are tunable at compile time via -DBIGMATH_*=N. Binary limb
+ * bases only (Base2_32 / Base2_64).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef GREATEST_COMMON_DIVISOR
+#define GREATEST_COMMON_DIVISOR
+
+#include <vector>
+
+#include "../common/Util.h"
+#include "gcd/HalfGcd.h"
+#include "gcd/LehmerGcd.h"
+
+namespace BigMath
+{
+  extern const SizeT HGCD_THRESHOLD;
+  extern const SizeT GCD_HGCD_THRESHOLD;
+
+  // gcd(a, b) of magnitudes; gcd(0, 0) = 0.
+  std::vector<DataT> Gcd(std::vector<DataT> const &a,
+                         std::vector<DataT> const &b,
+                         BaseT base);
+
+  // g = gcd(a, b) with g = s·a − t·b when sNegative is false and
+  // g = t·b − s·a when it is true (s, t are magnitudes).
+  std::vector<DataT> ExtendedGcd(std::vector<DataT> const &a,
+                                 std::vector<DataT> const &b,
+                                 std::vector<DataT> &s,
+                                 std::vector<DataT> &t,
+                                 bool &sNegative,
+                                 BaseT base);
+}
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * BigMath: integer power dispatcher
+ *
+ *   - a = 2^t·b: b^e by WindowedPower, then shifted by t·e bits
+ *   - b = 1      → the shift alone
+ *
+ * Binary limb bases only (Base2_32 / Base2_64).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef INTEGER_POWER
+#define INTEGER_POWER
+
+#include <vector>
+
+#include "../common/Util.h"
+#include "power/WindowedPower.h"
+
+namespace BigMath
+{
+  // a^e of a magnitude; 0^0 = 1. Throws invalid_argument when the result
+  // would not fit in SizeT limbs.
+  std::vector<DataT> Pow(std::vector<DataT> const &a, ULong e, BaseT base);
+}
+
+#endif
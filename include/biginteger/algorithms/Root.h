@@ -0,0 +1,35 @@
+/**
+ * BigMath: integer root dispatcher
+ *
+ *   - k = 2   → KaratsubaSquareRoot (Zimmermann's recursive SqrtRem)
+ *   - k ≥ 3   → NewtonRoot (precision-doubling Newton iteration)
+ *
+ * Binary limb bases only (Base2_32 / Base2_64).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef INTEGER_ROOT
+#define INTEGER_ROOT
+
+#include <vector>
+
+#include "../common/Util.h"
+#include "root/KaratsubaSquareRoot.h"
+#include "root/NewtonRoot.h"
+
+namespace BigMath
+{
+  // s = ⌊√a⌋, remainder = a − s².
+  std::vector<DataT> SqrtRem(std::vector<DataT> const &a,
+                             std::vector<DataT> &remainder,
+                             BaseT base);
+
+  // x = ⌊a^(1/k)⌋ for k ≥ 1, remainder = a − x^k.
+  std::vector<DataT> RootRem(std::vector<DataT> const &a,
+                             SizeT k,
+                             std::vector<DataT> &remainder,
+                             BaseT base);
+}
+
+#endif
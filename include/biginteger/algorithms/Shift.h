@@ -7,6 +7,7 @@
 #ifndef SHIFT
 #define SHIFT
 
+#include <algorithm>
 #include <vector>
 
 #include "../common/Util.h"
@@ -78,6 +79,130 @@ which in little‐endian form is
 
     return result;
   }
+
+  // Number of significant bits in v; 0 for zero.
+  inline SizeT BitLength(std::vector<DataT> const &v)
+  {
+    SizeT top = (SizeT)v.size();
+    while (top > 0 && v[top - 1] == 0)
+      --top;
+    if (top == 0)
+      return 0;
+    return (top - 1) * LimbBits + (SizeT)(64 - __builtin_clzll((ULong)v[top - 1]));
+  }
+
+  /*
+  Funnel-shift kernels on raw limbs, for off in [1, LimbBits). Each output
+  limb is built from two neighbouring input limbs,
+
+    left:  out[i] = in[i] << off | in[i − 1] >> (LimbBits − off)
+    right: out[i] = in[i] >> off | in[i + 1] << (LimbBits − off)
+
+  so there is no carry chain and the loops vectorize. The left kernel runs
+  from the top down and the right kernel from the bottom up, which makes
+  both safe in place (out ≥ in for left, out ≤ in for right).
+  */
+
+  // out[0 … n] = in[0 … n) · 2^off.
+  inline void FunnelShiftLeft(DataT *out, DataT const *in, SizeT n, SizeT off)
+  {
+    SizeT back = LimbBits - off;
+    out[n] = in[n - 1] >> back;
+    for (SizeT i = n - 1; i > 0; --i)
+      out[i] = ((in[i] << off) & LimbMask) | (in[i - 1] >> back);
+    out[0] = (in[0] << off) & LimbMask;
+  }
+
+  // out[0 … n) = in[0 … n) >> off.
+  inline void FunnelShiftRight(DataT *out, DataT const *in, SizeT n, SizeT off)
+  {
+    SizeT back = LimbBits - off;
+    for (SizeT i = 0; i + 1 < n; ++i)
+      out[i] = (in[i] >> off) | ((in[i + 1] << back) & LimbMask);
+    out[n - 1] = in[n - 1] >> off;
+  }
+
+  // v · 2^bits, any bit count.
+  inline std::vector<DataT> ShiftLeftBits(std::vector<DataT> const &v, ULong bits)
+  {
+    if (bits == 0)
+      return v;
+    if (IsZero(v))
+      return std::vector<DataT>{0};
+    // Sized from the significant limbs, so at most the carry limb is zero
+    // and the result never goes through an emptying trim.
+    SizeT n = FindNonZeroByte(v);
+    SizeT limbs = (SizeT)(bits / LimbBits);
+    SizeT off = (SizeT)(bits % LimbBits);
+    std::vector<DataT> out(n + limbs + 1, 0);
+    if (off == 0)
+      std::copy(v.begin(), v.begin() + n, out.begin() + limbs);
+    else
+      FunnelShiftLeft(out.data() + limbs, v.data(), n, off);
+    if (out.back() == 0)
+      out.pop_back();
+    return out;
+  }
+
+  // ⌊v / 2^bits⌋, any bit count.
+  inline std::vector<DataT> ShiftRightBits(std::vector<DataT> const &v, ULong bits)
+  {
+    if (bits == 0)
+      return v;
+    // As above: only the top limb of the sized output can shift out to zero.
+    SizeT n = FindNonZeroByte(v);
+    if (bits / LimbBits >= n)
+      return std::vector<DataT>{0};
+    SizeT limbs = (SizeT)(bits / LimbBits);
+    SizeT off = (SizeT)(bits % LimbBits);
+    std::vector<DataT> out(n - limbs);
+    if (off == 0)
+      std::copy(v.begin() + limbs, v.begin() + n, out.begin());
+    else
+      FunnelShiftRight(out.data(), v.data() + limbs, (SizeT)out.size(), off);
+    if (out.size() > 1 && out.back() == 0)
+      out.pop_back();
+    return out;
+  }
+
+  // v ← v · 2^bits.
+  inline void ShiftLeftBitsTo(std::vector<DataT> &v, ULong bits)
+  {
+    if (bits == 0 || IsZero(v))
+      return;
+    TrimZerosToOne(v);
+    SizeT n = (SizeT)v.size();
+    SizeT limbs = (SizeT)(bits / LimbBits);
+    SizeT off = (SizeT)(bits % LimbBits);
+    v.resize(n + limbs + 1, 0);
+    if (off == 0)
+      std::copy_backward(v.begin(), v.begin() + n, v.begin() + n + limbs);
+    else
+      FunnelShiftLeft(v.data() + limbs, v.data(), n, off);
+    std::fill(v.begin(), v.begin() + limbs, 0);
+    TrimZerosToOne(v);
+  }
+
+  // v ← ⌊v / 2^bits⌋.
+  inline void ShiftRightBitsTo(std::vector<DataT> &v, ULong bits)
+  {
+    if (bits == 0)
+      return;
+    if (bits / LimbBits >= v.size())
+    {
+      v.assign(1, 0);
+      return;
+    }
+    SizeT limbs = (SizeT)(bits / LimbBits);
+    SizeT off = (SizeT)(bits % LimbBits);
+    SizeT n = (SizeT)v.size() - limbs;
+    if (off == 0)
+      std::copy(v.begin() + limbs, v.end(), v.begin());
+    else
+      FunnelShiftRight(v.data(), v.data() + limbs, n, off);
+    v.resize(n);
+    TrimZerosToOne(v);
+  }
 }
 
 #endif
@@ -0,0 +1,235 @@
+/**
+ * BigMath: factorial, binomial and primorial from prime factorizations
+ * (Luschny's prime-swing factorial).
+ *
+ * The swing n≀ = n! / ⌊n/2⌋!² is a product of primes p ≤ n, each with
+ * exponent Σᵢ ⌊n/pⁱ⌋ mod 2, so
+ *
+ *   n! = ⌊n/2⌋!² · n≀
+ *
+ * costs one square and one product of about n/ln n small primes per
+ * level. Powers of two are stripped throughout: the odd parts recurse and
+ * n! = odd(n!) · 2^(n − popcount(n)) is shifted once at the end.
+ * C(n, k) takes the exponent of each p ≤ n from Kummer's theorem (the
+ * carries of k + (n − k) in base p). When k < n / BINOMIAL_SIEVE_RATIO the
+ * sieve stops at k instead: the primes of k! are divided out of the terms
+ * of n·(n−1)···(n−k+1), whose product is then exactly C(n, k).
+ *
+ * Prime powers are packed greedily into 64-bit words, and the words are
+ * multiplied in a balanced product tree: runs of PRODUCT_TREE_LEAF words
+ * by scalar multiplication, then pairwise through the Multiply dispatcher,
+ * so the top levels are equal-size NTT products.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef PRIME_SWING
+#define PRIME_SWING
+
+#include <vector>
+using namespace std;
+
+#include "../../common/Util.h"
+#include "../Multiplication.h"
+#include "../Shift.h"
+#include "../Squaring.h"
+#include "../multiplication/ClassicMultiplication.h"
+
+namespace BigMath
+{
+  // Primes up to a bound, odd numbers only.
+  class PrimeSieve
+  {
+  public:
+    explicit PrimeSieve(ULong limit) : limit(limit), composite(limit / 2 + 1, false)
+    {
+      for (ULong p = 3; p * p <= limit; p += 2)
+        if (!composite[p / 2])
+          for (ULong m = p * p; m <= limit; m += 2 * p)
+            composite[m / 2] = true;
+    }
+
+    ULong Limit() const { return limit; }
+
+    // f(p) for every prime p ≤ n (n ≤ Limit()), in increasing order.
+    template <typename F>
+    void ForEach(ULong n, F f) const
+    {
+      if (n >= 2)
+        f((ULong)2);
+      for (ULong p = 3; p <= n; p += 2)
+        if (!composite[p / 2])
+          f(p);
+    }
+
+  private:
+    ULong limit;
+    vector<bool> composite;
+  };
+
+  class PrimeSwing
+  {
+  public:
+    static const SizeT PRODUCT_TREE_LEAF = 16;
+    // C(n, k) goes through the sieve once k ≥ n / BINOMIAL_SIEVE_RATIO.
+    static const ULong BINOMIAL_SIEVE_RATIO = 4;
+
+  private:
+    // Factors packed into words below 2^64.
+    class Factors
+    {
+    public:
+      void Push(ULong x)
+      {
+        if (acc > ~(ULong)0 / x)
+        {
+          words.push_back(acc);
+          acc = 1;
+        }
+        acc *= x;
+      }
+
+      void Push(ULong p, ULong e)
+      {
+        for (; e > 0; --e)
+          Push(p);
+      }
+
+      vector<DataT> Product()
+      {
+        if (acc > 1)
+        {
+          words.push_back(acc);
+          acc = 1;
+        }
+        if (words.empty())
+          return vector<DataT>{1};
+        return PrimeSwing::Product(words, 0, (SizeT)words.size());
+      }
+
+    private:
+      vector<ULong> words;
+      ULong acc = 1;
+    };
+
+    static vector<DataT> Product(vector<ULong> const &words, SizeT lo, SizeT hi)
+    {
+      if (hi - lo <= PRODUCT_TREE_LEAF)
+      {
+        vector<DataT> r{1};
+        for (SizeT i = lo; i < hi; ++i)
+          ClassicMultiplication::MultiplyTo(r, (DataT)words[i], CurrentBase);
+        return r;
+      }
+      SizeT mid = lo + (hi - lo) / 2;
+      vector<DataT> r = Multiply(Product(words, lo, mid), Product(words, mid, hi), CurrentBase);
+      TrimZerosToOne(r);
+      return r;
+    }
+
+    // Odd part of n≀.
+    static vector<DataT> OddSwing(ULong n, PrimeSieve const &sieve)
+    {
+      Factors f;
+      sieve.ForEach(n, [&](ULong p) {
+        if (p == 2)
+          return;
+        ULong e = 0;
+        for (ULong q = n / p; q > 0; q /= p)
+          e += q & 1;
+        f.Push(p, e);
+      });
+      return f.Product();
+    }
+
+    // Odd part of n!.
+    static vector<DataT> OddFactorial(ULong n, PrimeSieve const &sieve)
+    {
+      if (n < 3)
+        return vector<DataT>{1};
+      vector<DataT> half = OddFactorial(n / 2, sieve);
+      vector<DataT> r = IsOne(half) ? half : Square(half, CurrentBase);
+      TrimZerosToOne(r);
+      vector<DataT> swing = OddSwing(n, sieve);
+      if (!IsOne(swing))
+      {
+        r = Multiply(r, swing, CurrentBase);
+        TrimZerosToOne(r);
+      }
+      return r;
+    }
+
+    static bool IsOne(vector<DataT> const &v)
+    {
+      return v.size() == 1 && v[0] == 1;
+    }
+
+  public:
+    // n!.
+    static vector<DataT> Factorial(ULong n)
+    {
+      PrimeSieve sieve(n);
+      vector<DataT> r = OddFactorial(n, sieve);
+      ShiftLeftBitsTo(r, n - (ULong)__builtin_popcountll(n));
+      return r;
+    }
+
+    // C(n, k); zero for k > n.
+    static vector<DataT> Binomial(ULong n, ULong k)
+    {
+      if (k > n)
+        return vector<DataT>{0};
+      if (k > n - k)
+        k = n - k;
+      if (k == 0)
+        return vector<DataT>{1};
+
+      if (k < n / BINOMIAL_SIEVE_RATIO)
+      {
+        // n·(n−1)···(n−k+1) with the primes of k! divided out of the
+        // terms, so only p ≤ k are sieved and nothing is left to divide.
+        ULong lo = n - k + 1;
+        vector<ULong> terms(k);
+        for (ULong i = 0; i < k; ++i)
+          terms[i] = lo + i;
+        PrimeSieve sieve(k);
+        sieve.ForEach(k, [&](ULong p) {
+          ULong e = 0;
+          for (ULong q = k / p; q > 0; q /= p)
+            e += q;
+          for (ULong i = (p - lo % p) % p; e > 0 && i < k; i += p)
+            for (; e > 0 && terms[i] % p == 0; --e)
+              terms[i] /= p;
+        });
+        Factors falling;
+        for (ULong t : terms)
+          if (t > 1)
+            falling.Push(t);
+        return falling.Product();
+      }
+
+      // Kummer: the exponent of p is the number of carries in k + (n − k).
+      PrimeSieve sieve(n);
+      Factors f;
+      ULong m = n - k;
+      sieve.ForEach(n, [&](ULong p) {
+        ULong e = 0;
+        for (ULong qn = n / p, qk = k / p, qm = m / p; qn > 0; qn /= p, qk /= p, qm /= p)
+          e += qn - qk - qm;
+        f.Push(p, e);
+      });
+      return f.Product();
+    }
+
+    // Product of the primes p ≤ n.
+    static vector<DataT> Primorial(ULong n)
+    {
+      PrimeSieve sieve(n);
+      Factors f;
+      sieve.ForEach(n, [&](ULong p) { f.Push(p); });
+      return f.Product();
+    }
+  };
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef BURNIKELZIEGLER_DIVISION
 #define BURNIKELZIEGLER_DIVISION
 
+#include <algorithm>
+#include <bit>
 #include <cstring>
 #include <span>
 #include <stdexcept>
@@ -9,8 +11,8 @@
 using namespace std;
 
 #include "../../common/Comparator.h"
+#include "../../common/Parallel.h"
 #include "../../common/Util.h"
-#include "../Addition.h"
 #include "../Multiplication.h"
 #include "../Shift.h"
 #include "FastDivision.h"
@@ -21,334 +23,213 @@ namespace BigMath
 #define BIGMATH_BZ_RECURSION_THRESHOLD 512
 #endif
 
+// Shortest slice of b0 one pool task multiplies by q̂ in a parallel
+// 3n/2n step.
+#ifndef BIGMATH_BZ_PARALLEL_SLICE
+#define BIGMATH_BZ_PARALLEL_SLICE 256
+#endif
+
+  // Burnikel–Ziegler recursive division. A 2n-by-n division is two
+  // 3n/2-by-n divisions, each one n/2-limb recursive division plus one
+  // n/2 × n/2 product, so the cost follows multiplication.
+  //
+  // The recursion runs in place on raw limbs: each step divides a window of
+  // the normalized dividend, leaving the remainder in the window's low limbs
+  // and the quotient in the caller's buffer. Products go to one workspace
+  // sized from the divisor up front, so the tree allocates nothing per node
+  // below the Toom-3 product size.
+  //
+  // With `workers` > 1, a q̂·b₀ product that would run on one thread (below
+  // the NTT size, whose transforms the pool already batches) is cut into up
+  // to that many slices of b₀ multiplied on the pool, each into its own
+  // buffer.
   class BurnikelZieglerDivision
   {
   private:
     static const SizeT BZ_THRESHOLD = BIGMATH_BZ_RECURSION_THRESHOLD;
+    static const SizeT BZ_PARALLEL_SLICE = BIGMATH_BZ_PARALLEL_SLICE;
 
-    static vector<DataT> NormalizeZero(vector<DataT> v)
+    static Int CompareTo(DataT const *x, DataT const *y, SizeT n)
     {
-      TrimZerosToOne(v);
-      return v;
+      for (SizeT i = n; i-- > 0;)
+        if (x[i] != y[i])
+          return x[i] < y[i] ? -1 : 1;
+      return 0;
     }
 
-    static vector<DataT> Slice(vector<DataT> const &v, SizeT start, SizeT count)
+    static bool IsZeroTo(DataT const *x, SizeT n)
     {
-      if (start >= v.size() || count == 0)
-        return vector<DataT>{0};
-      SizeT end = min((SizeT)v.size(), (SizeT)(start + count));
-      return NormalizeZero(vector<DataT>(v.begin() + start, v.begin() + end));
+      for (SizeT i = 0; i < n; ++i)
+        if (x[i] != 0)
+          return false;
+      return true;
     }
 
-    static vector<DataT> FromSpan(span<const DataT> v)
+    // r ← r + x over n limbs; returns the carry.
+    static ULong AddTo(DataT *r, DataT const *x, SizeT n)
     {
-      return NormalizeZero(vector<DataT>(v.begin(), v.end()));
-    }
-
-    static vector<DataT> MaxBlock(SizeT limbs, BaseT base)
-    {
-      if (limbs == 0)
-        return vector<DataT>{0};
-      // base - 1 underflows when base == Base2_64 sentinel (0); use LimbMask.
-      const DataT limbMax = (base == Base2_64) ? (DataT)0xFFFFFFFFFFFFFFFFULL
-                                                : (DataT)(base - 1);
-      return vector<DataT>(limbs, limbMax);
-    }
-
-    static void PadTo(vector<DataT> &v, SizeT limbs)
-    {
-      if (IsZero(v))
-        v.clear();
-      while (v.size() < limbs)
-        v.push_back(0);
+      ULong carry = 0;
+      for (SizeT i = 0; i < n; ++i)
+      {
+        ULong128 s = (ULong128)r[i] + x[i] + carry;
+        r[i] = (DataT)s & LimbMask;
+        carry = (ULong)(s >> LimbBits);
+      }
+      return carry;
     }
 
-    // Bit-shift left by [1..LimbBits] bits. Caller ensures shift ∈ [0,LimbBits].
-    static vector<DataT> ShiftLeftBits(vector<DataT> const &v, Int shift)
+    // r ← r − x over n limbs, then the borrow through r[n, len); returns
+    // the borrow out of limb len − 1.
+    static ULong SubtractFrom(DataT *r, SizeT len, DataT const *x, SizeT n)
     {
-      if (shift == 0 || IsZero(v))
-        return v;
-      vector<DataT> out(v.size() + 1, 0);
-      for (SizeT i = 0; i < v.size(); ++i)
+      ULong borrow = 0;
+      for (SizeT i = 0; i < n; ++i)
       {
-#if BIGMATH_LIMB_64
-        ULong128 cur = (ULong128)v[i] << shift;
-        out[i] |= (DataT)(cur & 0xFFFFFFFFFFFFFFFFULL);
-        out[i + 1] |= (DataT)(cur >> 64);
-#else
-        ULong cur = (ULong)v[i] << shift;
-        out[i] |= (DataT)(cur & 0xFFFFFFFFULL);
-        out[i + 1] |= (DataT)(cur >> 32);
-#endif
+        DataT t = (r[i] - x[i]) & LimbMask;
+        ULong under = r[i] < x[i];
+        r[i] = (t - borrow) & LimbMask;
+        borrow = under | (t < borrow);
       }
-      TrimZerosToOne(out);
-      return out;
+      for (SizeT i = n; borrow != 0 && i < len; ++i)
+      {
+        borrow = r[i] == 0;
+        r[i] = (r[i] - 1) & LimbMask;
+      }
+      return borrow;
     }
 
-    // Bit-shift right by [0..LimbBits] bits.
-    static vector<DataT> ShiftRightBits(vector<DataT> const &v, Int shift)
+    static void Decrement(DataT *x, SizeT n)
     {
-      if (shift == 0 || IsZero(v))
-        return v;
-      vector<DataT> out(v.size(), 0);
-      for (Int i = 0; i < (Int)v.size(); ++i)
+      for (SizeT i = 0; i < n; ++i)
       {
-#if BIGMATH_LIMB_64
-        ULong128 cur = (ULong128)v[i];
-        if (i + 1 < (Int)v.size())
-          cur |= ((ULong128)v[i + 1]) << 64;
-        out[i] = (DataT)((cur >> shift) & 0xFFFFFFFFFFFFFFFFULL);
-#else
-        ULong cur = v[i];
-        if (i + 1 < (Int)v.size())
-          cur |= ((ULong)v[i + 1]) << 32;
-        out[i] = (DataT)((cur >> shift) & 0xFFFFFFFFULL);
-#endif
+        bool borrow = x[i] == 0;
+        x[i] = (x[i] - 1) & LimbMask;
+        if (!borrow)
+          return;
       }
-      TrimZerosToOne(out);
-      return out;
     }
 
-    // Number of bits to shift left so that b's limb count becomes b.size()+1.
-    // Pushes b's MSB into a new high limb. Returns shift ∈ [1,LimbBits].
-    static Int BitsToBumpLimbCount(vector<DataT> const &b)
+    // Limbs the recursion needs beside the operands for an n-limb divisor:
+    // q·b0 (n limbs at the top level) and Karatsuba's scratch for it. Toom-3
+    // and NTT products go through the dispatcher and bring their own.
+    static SizeT WorkspaceLimbs(SizeT n)
     {
-      DataT top = b.back();
-#if BIGMATH_LIMB_64
-      Int bits_top = 64 - __builtin_clzll((unsigned long long)top);
-      return 65 - bits_top; // 1..64
-#else
-      Int bits_top = 32 - __builtin_clz((unsigned int)top);
-      return 33 - bits_top; // 1..32
-#endif
+      return n + KaratsubaMultiplication::WorkspaceLimbs(std::min(n / 2, TOOM3_MULTIPLICATION_THRESHOLD));
     }
 
-    static void Decrement(vector<DataT> &v, BaseT base)
+    // c[0, lx + ly) = x · y, c and w disjoint.
+    static void MultiplyInto(DataT const *x, SizeT lx, DataT const *y, SizeT ly, DataT *c, DataT *w)
     {
-      // limbMax is base-1 for power-of-two bases. The BaseT sentinel for
-      // Base2_64 is 0, so (base - 1) would underflow — use LimbMask.
-      const DataT limbMax = (base == Base2_64) ? (DataT)0xFFFFFFFFFFFFFFFFULL
-                                                : (DataT)(base - 1);
-      SizeT i = 0;
-      while (i < v.size())
+      if (lx + ly < TOOM3_MULTIPLICATION_THRESHOLD)
       {
-        if (v[i] > 0)
-        {
-          --v[i];
-          break;
-        }
-        v[i] = limbMax;
-        ++i;
+        KaratsubaMultiplication::MultiplyInto(x, lx, y, ly, c, w, CurrentBase);
+        return;
       }
-      TrimZerosToOne(v);
+      vector<DataT> p = Multiply(vector<DataT>(x, x + lx), vector<DataT>(y, y + ly), CurrentBase);
+      SizeT len = std::min((SizeT)p.size(), lx + ly);
+      std::memcpy(c, p.data(), len * sizeof(DataT));
+      std::memset(c + len, 0, (lx + ly - len) * sizeof(DataT));
     }
 
-    // out = (high << shift_limbs) + low. One allocation.
-    static vector<DataT> AddShifted(
-        vector<DataT> const &high, SizeT shift,
-        const DataT *lowData, SizeT lowSize,
-        BaseT base)
+    // a[0, 2n) / b for a normalized n-limb b and a[n, 2n) < b: the n
+    // quotient limbs go to q, the remainder to a[0, n), and a[n, 2n) is
+    // zeroed.
+    static void Divide2nByN(DataT *q, DataT *a, DataT const *b, SizeT n, DataT *w, SizeT workers)
     {
-      SizeT outSize = max(high.size() + shift, (size_t)lowSize) + 1;
-      vector<DataT> out(outSize, 0);
-
-      std::memcpy(out.data(), lowData, lowSize * sizeof(DataT));
-
-      if (base == Base2_64)
+      if (IsZeroTo(a + n, n) && CompareTo(a, b, n) < 0)
       {
-        ULong128 carry = 0;
-        SizeT i = 0;
-        for (; i < high.size(); ++i)
-        {
-          ULong128 sum = (ULong128)out[shift + i] + high[i] + carry;
-          out[shift + i] = (DataT)(sum & 0xFFFFFFFFFFFFFFFFULL);
-          carry = sum >> 64;
-        }
-        SizeT idx = shift + i;
-        while (carry)
-        {
-          if (idx >= out.size())
-            out.push_back(0);
-          ULong128 sum = (ULong128)out[idx] + carry;
-          out[idx] = (DataT)(sum & 0xFFFFFFFFFFFFFFFFULL);
-          carry = sum >> 64;
-          ++idx;
-        }
-        return out;
+        std::memset(q, 0, n * sizeof(DataT));
+        return;
       }
-
-      ULong carry = 0;
-      SizeT i = 0;
-      for (; i < high.size(); ++i)
-      {
-        ULong sum = (ULong)out[shift + i] + high[i] + carry;
-        if (base == Base2_32)
-        {
-          out[shift + i] = (DataT)(sum & 0xFFFFFFFFULL);
-          carry = sum >> 32;
-        }
-        else
-        {
-          out[shift + i] = (DataT)(sum % base);
-          carry = sum / base;
-        }
-      }
-      SizeT idx = shift + i;
-      while (carry)
+      if (n <= BZ_THRESHOLD || n % 2 != 0)
       {
-        if (idx >= out.size())
-          out.push_back(0);
-        ULong sum = (ULong)out[idx] + carry;
-        if (base == Base2_32)
-        {
-          out[idx] = (DataT)(sum & 0xFFFFFFFFULL);
-          carry = sum >> 32;
-        }
-        else
-        {
-          out[idx] = (DataT)(sum % base);
-          carry = sum / base;
-        }
-        ++idx;
+        FastDivision::DivideNormalizedTo(q, a, 2 * n, b, n);
+        return;
       }
-      return out;
-    }
 
-    static vector<DataT> CombineShifted(
-        vector<DataT> const &high,
-        SizeT shift,
-        vector<DataT> const &low,
-        BaseT base)
-    {
-      vector<DataT> out = AddShifted(high, shift, low.data(), (SizeT)low.size(), base);
-      return NormalizeZero(std::move(out));
+      SizeT m = n / 2;
+      Divide3nBy2n(q + m, a + m, b, m, w, workers);
+      Divide3nBy2n(q, a, b, m, w, workers);
     }
 
-    // Full Burnikel-Ziegler 2n-by-n division. For n = 2m, split the dividend
-    // into four m-limb blocks and the divisor into two m-limb blocks, then use
-    // two 3n-by-2n divisions.
-    static pair<vector<DataT>, vector<DataT>> Divide2nByN(
-        vector<DataT> const &a,
-        vector<DataT> const &b,
-        BaseT base,
-        bool computeRemainder)
+    // a[0, 2m) −= q[0, lq) · b[0, m) in slices of b on the pool; returns the
+    // borrow out of limb 2m − 1.
+    static ULong SubtractProductParallel(DataT *a, DataT const *q, SizeT lq, DataT const *b, SizeT m, SizeT slices)
     {
-      if (IsZero(b))
-        throw invalid_argument("Division by zero");
-
-      if (Compare(a, b) < 0)
-        return {vector<DataT>{0}, computeRemainder ? a : vector<DataT>()};
-      if (Compare(a, b) == 0)
-        return {vector<DataT>{1}, computeRemainder ? vector<DataT>{0} : vector<DataT>()};
-
-      SizeT n = (SizeT)b.size();
-      if (n <= BZ_THRESHOLD || n % 2 != 0 || a.size() <= BZ_THRESHOLD)
-        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-      if (a.size() > 2 * n)
-        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-      SizeT m = n / 2;
-      vector<DataT> a0 = Slice(a, 0, m);
-      vector<DataT> a1 = Slice(a, m, m);
-      vector<DataT> a2 = Slice(a, 2 * m, m);
-      vector<DataT> a3 = Slice(a, 3 * m, m);
-      vector<DataT> b0 = Slice(b, 0, m);
-      vector<DataT> b1 = Slice(b, m, m);
-
-      // Divide A = x2*B^(2m) + x1*B^m + x0 by
-      // D = b1*B^m + b0, returning Q < B^m and R < D.
-      auto divide3nBy2n = [&](vector<DataT> const &x2,
-                              vector<DataT> const &x1,
-                              vector<DataT> const &x0) {
-        vector<DataT> top = CombineShifted(x2, m, x1, base);
-        vector<DataT> q;
-        vector<DataT> r;
-
-        if (Compare(x2, b1) < 0)
+      SizeT len = (m + slices - 1) / slices;
+      vector<vector<DataT>> products(slices);
+      ParallelDo((Int)slices, [&](Int start, Int end) {
+        for (Int i = start; i < end; ++i)
         {
-          auto qr = Divide2nByN(top, b1, base, true);
-          q = std::move(qr.first);
-          r = std::move(qr.second);
+          SizeT off = (SizeT)i * len, ls = std::min(len, m - off);
+          vector<DataT> work(KaratsubaMultiplication::WorkspaceLimbs(std::max(lq, ls)));
+          products[i].resize(lq + ls);
+          MultiplyInto(q, lq, b + off, ls, products[i].data(), work.data());
         }
-        else
-        {
-          q = MaxBlock(m, base);
-          vector<DataT> product = Multiply(q, b1, base);
-          r = Subtract(top, product, base);
-        }
-
-        vector<DataT> d = Multiply(q, b0, base);
-        r = CombineShifted(r, m, x0, base);
-        vector<DataT> divisor = CombineShifted(b1, m, b0, base);
-
-        while (Compare(r, d) < 0)
-        {
-          Decrement(q, base);
-          r = Add(r, divisor, base);
-        }
-
-        r = Subtract(r, d, base);
-        return pair<vector<DataT>, vector<DataT>>{
-            NormalizeZero(std::move(q)),
-            NormalizeZero(std::move(r))};
-      };
-
-      auto high = divide3nBy2n(a3, a2, a1);
-      vector<DataT> r1Low = Slice(high.second, 0, m);
-      vector<DataT> r1High = Slice(high.second, m, m);
-      auto low = divide3nBy2n(r1High, r1Low, a0);
-
-      PadTo(low.first, m);
-      vector<DataT> q = CombineShifted(high.first, m, low.first, base);
-      TrimZerosToOne(q);
-
-      return {q, computeRemainder ? low.second : vector<DataT>()};
+      });
+      ULong borrow = 0;
+      for (SizeT i = 0; i < slices; ++i)
+      {
+        SizeT off = i * len;
+        borrow += SubtractFrom(a + off, 2 * m - off, products[i].data(), (SizeT)products[i].size());
+      }
+      return borrow;
     }
 
-    // Arbitrary-size wrapper: process the dividend in base B^n blocks and use
-    // the balanced 2n-by-n primitive for each combined remainder/block step.
-    static pair<vector<DataT>, vector<DataT>> DivideRecursive(
-        vector<DataT> const &a,
-        vector<DataT> const &b,
-        BaseT base,
-        bool computeRemainder)
+    // a[0, 3m) / b for b = b1·B^m + b0 of 2m limbs and a[m, 3m) < b. The m
+    // quotient limbs go to q and the remainder to a[0, 2m).
+    static void Divide3nBy2n(DataT *q, DataT *a, DataT const *b, SizeT m, DataT *w, SizeT workers)
     {
-      if (a.size() <= BZ_THRESHOLD || b.size() <= BZ_THRESHOLD || b.size() % 2 != 0)
-        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-      SizeT n = (SizeT)b.size();
-      SizeT blocks = (a.size() + n - 1) / n;
-      vector<DataT> rem{0};
-      vector<DataT> quotient(blocks * n, 0);
-
-      for (SizeT block = blocks; block > 0; --block)
+      DataT const *b1 = b + m;
+      if (CompareTo(a + 2 * m, b1, m) < 0)
       {
-        SizeT start = (block - 1) * n;
-        vector<DataT> low = Slice(a, start, n);
-        vector<DataT> combined = CombineShifted(rem, n, low, base);
-
-        auto qr = Divide2nByN(combined, b, base, true);
-        vector<DataT> qBlock = std::move(qr.first);
-        rem = std::move(qr.second);
-
-        if (qBlock.size() > n)
-          return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-        std::memcpy(quotient.data() + start, qBlock.data(), qBlock.size() * sizeof(DataT));
+        // q̂ = (a2·B^m + a1) / b1, the remainder R1 left in a[m, 2m).
+        Divide2nByN(q, a + m, b1, m, w, workers);
+      }
+      else
+      {
+        // a2 = b1: q̂ = B^m − 1 and R1 = a1 + b1, with its carry in a[2m].
+        for (SizeT i = 0; i < m; ++i)
+          q[i] = LimbMask;
+        std::memset(a + 2 * m, 0, m * sizeof(DataT));
+        a[2 * m] = AddTo(a + m, b1, m);
       }
 
-      TrimZerosToOne(quotient);
-
-      return {quotient, computeRemainder ? NormalizeZero(std::move(rem)) : vector<DataT>()};
+      // R = R1·B^m + a0 − q̂·b0; q̂ is at most two too large.
+      Int top = (Int)a[2 * m];
+      SizeT lq = m;
+      while (lq > 0 && q[lq - 1] == 0)
+        --lq;
+      SizeT slices = workers > 1 && lq + m < NTT_MULTIPLICATION_THRESHOLD
+                         ? std::min(workers, m / BZ_PARALLEL_SLICE)
+                         : 1;
+      if (slices > 1 && lq >= BZ_PARALLEL_SLICE)
+      {
+        top -= (Int)SubtractProductParallel(a, q, lq, b, m, slices);
+      }
+      else if (lq != 0)
+      {
+        MultiplyInto(q, lq, b, m, w, w + 2 * m);
+        top -= (Int)SubtractFrom(a, 2 * m, w, lq + m);
+      }
+      while (top < 0)
+      {
+        Decrement(q, m);
+        top += (Int)AddTo(a, b, 2 * m);
+      }
+      a[2 * m] = 0;
     }
 
   public:
+    // computeQuotient = false leaves the quotient empty: blocks still divide,
+    // but their digits are never assembled (Remainder).
     static pair<vector<DataT>, vector<DataT>> DivideAndRemainder(
         span<const DataT> a,
         span<const DataT> b,
         BaseT base,
-        bool computeRemainder = true)
+        bool computeRemainder = true,
+        bool computeQuotient = true,
+        SizeT workers = 1)
     {
       if (IsZero(b))
         throw invalid_argument("Division by zero");
@@ -362,48 +243,64 @@ namespace BigMath
       if (cmp == 0)
         return {vector<DataT>{1}, computeRemainder ? vector<DataT>{0} : vector<DataT>()};
 
-      if (a.size() <= BZ_THRESHOLD || b.size() <= BZ_THRESHOLD)
-        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-      // Knuth-normalize the divisor (top bit of b.back() set). Required for BZ's
-      // 3n/2n correction-loop bound of 2 iterations; without it the loop runs O(B)
-      // times when the recursive q-estimate is wildly off (PR #30 LIMB_64 sparse-input
-      // hang was here — divisor.back() = 1 forced ~2^64 correction iters).
-      DataT b_top = b[b.size() - 1];
-      Int shift = 0;
-#if BIGMATH_LIMB_64
-      const DataT topBitMask = 0x8000000000000000ULL;
-#else
-      const DataT topBitMask = 0x80000000U;
-#endif
-      while ((b_top & topBitMask) == 0)
+      if (base != CurrentBase || a.size() <= BZ_THRESHOLD || b.size() <= BZ_THRESHOLD)
+        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder, computeQuotient);
+
+      // Pad the divisor with low zero limbs to n = m·2^k, m ≤ the threshold,
+      // so every level halves evenly, and shift its top bit up: the 3n/2n
+      // correction then runs at most twice. a is scaled to match; the
+      // quotient is unchanged and the remainder scales back.
+      SizeT nb = (SizeT)b.size();
+      SizeT na = (SizeT)a.size();
+      SizeT m = nb, k = 0;
+      while (m > BZ_THRESHOLD)
       {
-        b_top <<= 1;
-        ++shift;
+        m = (m + 1) / 2;
+        ++k;
+      }
+      SizeT n = m << k;
+      SizeT pad = n - nb;
+      SizeT shift = (SizeT)(std::countl_zero(b[nb - 1]) - (64 - LimbBits));
+
+      // The dividend in blocks of n limbs below one block of zeros, which
+      // the first window divides as its high half.
+      SizeT la = na + pad + 1;
+      SizeT blocks = (la + n - 1) / n;
+      vector<DataT> u((blocks + 1) * n, 0);
+      vector<DataT> work(n + 1 + WorkspaceLimbs(n), 0);
+      DataT *bn = work.data();
+      DataT *w = bn + n + 1;
+      if (shift == 0)
+      {
+        std::copy(a.begin(), a.end(), u.begin() + pad);
+        std::copy(b.begin(), b.end(), bn + pad);
+      }
+      else
+      {
+        FunnelShiftLeft(u.data() + pad, a.data(), na, shift);
+        FunnelShiftLeft(bn + pad, b.data(), nb, shift);
       }
 
-      vector<DataT> aNorm = (shift > 0)
-                                ? ShiftLeftBits(vector<DataT>(a.begin(), a.end()), shift)
-                                : vector<DataT>(a.begin(), a.end());
-      vector<DataT> bNorm = (shift > 0)
-                                ? ShiftLeftBits(vector<DataT>(b.begin(), b.end()), shift)
-                                : vector<DataT>(b.begin(), b.end());
+      // Without the quotient every block writes the same n limbs.
+      vector<DataT> q(computeQuotient ? blocks * n : n, 0);
+      for (SizeT block = blocks; block-- > 0;)
+        Divide2nByN(q.data() + (computeQuotient ? block * n : 0), u.data() + block * n, bn, n, w, workers);
 
-      // BZ recursion needs even divisor size for the 2n-by-n split. If post-normalize
-      // size is odd, fall to FastDivision — which has its own internal normalization
-      // and isn't sensitive to BZ's correction-loop bound.
-      if (bNorm.size() % 2 != 0)
+      vector<DataT> r;
+      if (computeRemainder)
       {
-        auto qr = FastDivision::DivideAndRemainder(aNorm, bNorm, base, computeRemainder);
-        if (computeRemainder && shift > 0)
-          qr.second = ShiftRightBits(qr.second, shift);
-        return qr;
+        r.assign(n - pad, 0);
+        if (shift == 0)
+          std::copy(u.begin() + pad, u.begin() + n, r.begin());
+        else
+          FunnelShiftRight(r.data(), u.data() + pad, n - pad, shift);
+        TrimZerosToOne(r);
       }
-
-      auto qr = DivideRecursive(aNorm, bNorm, base, computeRemainder);
-      if (computeRemainder && shift > 0)
-        qr.second = ShiftRightBits(qr.second, shift);
-      return qr;
+      if (computeQuotient)
+        TrimZerosToOne(q);
+      else
+        q.clear();
+      return {q, r};
     }
 
     static vector<DataT> Divide(span<const DataT> a, span<const DataT> b, BaseT base)
@@ -411,20 +308,32 @@ namespace BigMath
       return DivideAndRemainder(a, b, base, false).first;
     }
 
+    static vector<DataT> Remainder(span<const DataT> a, span<const DataT> b, BaseT base)
+    {
+      return DivideAndRemainder(a, b, base, true, false).second;
+    }
+
     // Vector overloads — backward compat.
     static pair<vector<DataT>, vector<DataT>> DivideAndRemainder(
         vector<DataT> const &a,
         vector<DataT> const &b,
         BaseT base,
-        bool computeRemainder = true)
+        bool computeRemainder = true,
+        bool computeQuotient = true,
+        SizeT workers = 1)
     {
-      return DivideAndRemainder(span<const DataT>(a), span<const DataT>(b), base, computeRemainder);
+      return DivideAndRemainder(span<const DataT>(a), span<const DataT>(b), base, computeRemainder, computeQuotient, workers);
     }
 
     static vector<DataT> Divide(vector<DataT> const &a, vector<DataT> const &b, BaseT base)
     {
       return DivideAndRemainder(a, b, base, false).first;
     }
+
+    static vector<DataT> Remainder(vector<DataT> const &a, vector<DataT> const &b, BaseT base)
+    {
+      return DivideAndRemainder(a, b, base, true, false).second;
+    }
   };
 }
 
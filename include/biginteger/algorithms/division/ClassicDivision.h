@@ -8,6 +8,7 @@
 #define CLASSIC_DIVISION
 
 #include <cstddef>
+#include <span>
 #include <vector>
 #include <string>
 #include <stdexcept>
@@ -65,6 +66,63 @@ namespace BigMath
             }
         };
 
+        // Remainder-only reduction by d with 64-bit limbs. With c_i = B^i mod d,
+        // four limbs fold into a two-limb residue h·B + l as
+        //   h·c5 + l·c4 + u3·c3 + u2·c2 + u1·c1 + u0,
+        // five independent products in place of four dependent reciprocal
+        // steps, and one reciprocal division at the end. The sum stays below
+        // B² while 5d < B (Möller–Granlund 2011, section 8; GMP mod_1s_4p).
+        struct LimbFolder
+        {
+            GranlundMollerDivider gm;
+            ULong c[6];
+
+            static bool Fits(ULong d) { return d <= ~(ULong)0 / 5; }
+
+            explicit LimbFolder(ULong divisor) : gm(divisor)
+            {
+                ULong r = 1;
+                c[0] = 1;
+                for (int i = 1; i < 6; ++i)
+                    gm.DivMod(r, 0, r), c[i] = r;
+            }
+
+            // (h, l) ← (h·B + l)·B + limb, reduced.
+            inline void Fold(ULong &h, ULong &l, DataT limb) const
+            {
+                ULong128 s = (ULong128)h * c[2] + (ULong128)l * c[1] + limb;
+                h = (ULong)(s >> 64);
+                l = (ULong)s;
+            }
+
+            // (h, l) ← (h·B + l)·B⁴ + u[3]·B³ + … + u[0], reduced.
+            inline void Fold4(ULong &h, ULong &l, DataT const *u) const
+            {
+                ULong128 s = (ULong128)h * c[5] + (ULong128)l * c[4] +
+                             (ULong128)u[3] * c[3] + (ULong128)u[2] * c[2] +
+                             (ULong128)u[1] * c[1] + u[0];
+                h = (ULong)(s >> 64);
+                l = (ULong)s;
+            }
+
+            // Limbs [begin, end) of u, most significant first.
+            inline void FoldRange(ULong &h, ULong &l, DataT const *u, SizeT begin, SizeT end) const
+            {
+                while ((end - begin) % 4 != 0)
+                    Fold(h, l, u[--end]);
+                for (; end > begin; end -= 4)
+                    Fold4(h, l, u + end - 4);
+            }
+
+            inline ULong Reduce(ULong h, ULong l) const
+            {
+                ULong r;
+                gm.DivMod(0, h, r);
+                gm.DivMod(r, l, r);
+                return r;
+            }
+        };
+
         static void DivideTo(vector<DataT> &u, DataT d, BaseT base)
         {
             Divide(u, 0, u.size() - 1, d, u, 0, u.size() - 1, base);
@@ -178,6 +236,65 @@ namespace BigMath
             TrimZeros(w);
         }
 
+        // u mod d without forming the quotient.
+        static DataT Mod(span<const DataT> u, DataT d, BaseT base)
+        {
+            if (d == 0)
+                throw invalid_argument("Division by zero");
+
+            ULong r = 0;
+            if (base == Base2_32)
+            {
+                GranlundMollerDivider gm(d);
+                for (SizeT i = (SizeT)u.size(); i-- > 0;)
+                {
+                    ULong128 acc = ((ULong128)r << 32) | u[i];
+                    gm.DivMod((ULong)(acc >> 64), (ULong)acc, r);
+                }
+                return (DataT)r;
+            }
+
+            if (base == Base2_64 && u.size() >= 8 && LimbFolder::Fits(d))
+            {
+                LimbFolder f(d);
+                ULong h = 0, l = 0;
+                f.FoldRange(h, l, u.data(), 0, (SizeT)u.size());
+                return (DataT)f.Reduce(h, l);
+            }
+
+            if (base == Base2_64)
+            {
+                GranlundMollerDivider gm(d);
+                for (SizeT i = (SizeT)u.size(); i-- > 0;)
+                    gm.DivMod(r, u[i], r);
+                return (DataT)r;
+            }
+
+            for (SizeT i = (SizeT)u.size(); i-- > 0;)
+                r = (r * base + u[i]) % d;
+            return (DataT)r;
+        }
+
+        // u mod d for every d in divisors, in one pass over u: limbs are
+        // taken in blocks that stay in L1 while every divisor sweeps them.
+        static vector<DataT> Mod(span<const DataT> u, span<const DataT> divisors, BaseT base)
+        {
+            for (DataT d : divisors)
+                if (d == 0)
+                    throw invalid_argument("Division by zero");
+
+            vector<DataT> r(divisors.size(), 0);
+            if (base == Base2_32 || base == Base2_64)
+                ModBlocks(u, divisors, base, r);
+            else
+            {
+                for (SizeT i = (SizeT)u.size(); i-- > 0;)
+                    for (SizeT j = 0; j < divisors.size(); ++j)
+                        r[j] = (DataT)(((ULong)r[j] * base + u[i]) % divisors[j]);
+            }
+            return r;
+        }
+
         // In-place divmod by single-limb d. Returns remainder.
         // Quotient overwrites u; trailing zero limbs trimmed.
         static DataT DivModTo(vector<DataT> &u, DataT d, BaseT base)
@@ -404,6 +521,52 @@ namespace BigMath
 
             return {quotient, remainder};
         }
+
+    private:
+        // Power-of-two bases. Divisors that fit fold four limbs per step with
+        // 64-bit limbs; the rest take one reciprocal step per limb.
+        static void ModBlocks(span<const DataT> u, span<const DataT> divisors, BaseT base, vector<DataT> &out)
+        {
+            constexpr SizeT Block = 512;
+            SizeT k = (SizeT)divisors.size();
+
+            vector<LimbFolder> f;
+            vector<bool> folds(k);
+            f.reserve(k);
+            for (SizeT j = 0; j < k; ++j)
+            {
+                f.emplace_back(divisors[j]);
+                folds[j] = base == Base2_64 && LimbFolder::Fits(divisors[j]);
+            }
+            vector<ULong> h(k, 0), l(k, 0);
+
+            for (SizeT end = (SizeT)u.size(); end > 0;)
+            {
+                SizeT begin = end > Block ? end - Block : 0;
+                for (SizeT j = 0; j < k; ++j)
+                {
+                    if (folds[j])
+                        f[j].FoldRange(h[j], l[j], u.data(), begin, end);
+                    else if (base == Base2_64)
+                    {
+                        for (SizeT i = end; i-- > begin;)
+                            f[j].gm.DivMod(l[j], u[i], l[j]);
+                    }
+                    else
+                    {
+                        for (SizeT i = end; i-- > begin;)
+                        {
+                            ULong128 acc = ((ULong128)l[j] << 32) | u[i];
+                            f[j].gm.DivMod((ULong)(acc >> 64), (ULong)acc, l[j]);
+                        }
+                    }
+                }
+                end = begin;
+            }
+
+            for (SizeT j = 0; j < k; ++j)
+                out[j] = (DataT)(folds[j] ? f[j].Reduce(h[j], l[j]) : l[j]);
+        }
     };
 }
 
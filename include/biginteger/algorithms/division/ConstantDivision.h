@@ -0,0 +1,191 @@
+/**
+ * BigMath: Division by compile-time-constant single-limb divisors.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef CONSTANT_DIVISION
+#define CONSTANT_DIVISION
+
+#include <bit>
+#include <span>
+#include <vector>
+using namespace std;
+
+#include "../../common/Util.h"
+
+namespace BigMath
+{
+  namespace ConstantDivision
+  {
+    // d⁻¹ mod 2^64 for odd d: d·d ≡ 1 (mod 8), and each step doubles the bits.
+    constexpr ULong InverseOdd(ULong d)
+    {
+      ULong x = d;
+      for (int i = 0; i < 5; ++i)
+        x *= 2 - d * x;
+      return x;
+    }
+
+    // c[i] = 2^(64·i) mod d.
+    struct FoldTable
+    {
+      ULong c[6];
+
+      constexpr explicit FoldTable(ULong d) : c{}
+      {
+        c[0] = 1 % d;
+        for (int i = 1; i < 6; ++i)
+          c[i] = (ULong)(((ULong128)c[i - 1] << 64) % d);
+      }
+
+      constexpr ULong operator[](int i) const { return c[i]; }
+    };
+  }
+
+  // Division by a single-limb divisor fixed at compile time: 10^19 when
+  // formatting decimals, 10^k when rescaling. The Möller–Granlund reciprocal,
+  // the normalization shift, the fold constants B^i mod D and the 2-adic
+  // inverse of D's odd part are all constants, so nothing is set up per call
+  // and the compiler sees immediates in every limb step.
+  //
+  // D may exceed the limb base with 32-bit limbs, as 10^19 does; the
+  // remainder is then wider than a limb.
+  template <ULong D>
+  class ConstantDivider
+  {
+    static_assert(D != 0, "Division by zero");
+
+  public:
+    static constexpr int Shift = std::countl_zero(D);
+    static constexpr ULong Normalized = D << Shift;
+    // floor((2^128 − 1) / Normalized) − 2^64.
+    static constexpr ULong Reciprocal = (ULong)(~(ULong128)0 / Normalized);
+
+    // D = 2^Twos · Odd.
+    static constexpr int Twos = std::countr_zero(D);
+    static constexpr ULong Odd = D >> Twos;
+
+    // (h·2^64 + l) / D for h < D; the remainder goes to rem.
+    static inline ULong DivMod(ULong h, ULong l, ULong &rem)
+    {
+      ULong u1 = h, u0 = l;
+      if constexpr (Shift != 0)
+      {
+        u1 = (h << Shift) | (l >> (64 - Shift));
+        u0 = l << Shift;
+      }
+      ULong128 q = (ULong128)Reciprocal * u1;
+      q += ((ULong128)u1 << 64) | u0;
+      ULong q1 = (ULong)(q >> 64) + 1;
+      ULong q0 = (ULong)q;
+      ULong r = u0 - q1 * Normalized;
+      if (r > q0) { q1--; r += Normalized; }
+      if (r >= Normalized) { q1++; r -= Normalized; }
+      rem = r >> Shift;
+      return q1;
+    }
+
+    // Quotient in place, high zero limbs trimmed to one; returns u mod D.
+    static ULong DivModTo(vector<DataT> &u)
+    {
+      ULong r = 0;
+      for (SizeT i = (SizeT)u.size(); i-- > 0;)
+        u[i] = (DataT)Step(r, u[i]);
+      while (u.size() > 1 && u.back() == 0)
+        u.pop_back();
+      return r;
+    }
+
+    static ULong Mod(span<const DataT> u)
+    {
+      SizeT n = (SizeT)u.size();
+      if constexpr (LimbBits == 64 && D <= ~(ULong)0 / 5)
+      {
+        // Four limbs per step as in ClassicDivision::LimbFolder.
+        ULong h = 0, l = 0;
+        while (n % 4 != 0)
+        {
+          --n;
+          ULong128 s = (ULong128)h * Fold[2] + (ULong128)l * Fold[1] + u[n];
+          h = (ULong)(s >> 64);
+          l = (ULong)s;
+        }
+        for (; n > 0; n -= 4)
+        {
+          ULong128 s = (ULong128)h * Fold[5] + (ULong128)l * Fold[4] +
+                       (ULong128)u[n - 1] * Fold[3] + (ULong128)u[n - 2] * Fold[2] +
+                       (ULong128)u[n - 3] * Fold[1] + u[n - 4];
+          h = (ULong)(s >> 64);
+          l = (ULong)s;
+        }
+        ULong r;
+        DivMod(0, h, r);
+        DivMod(r, l, r);
+        return r;
+      }
+      else
+      {
+        ULong r = 0;
+        while (n-- > 0)
+          Step(r, u[n]);
+        return r;
+      }
+    }
+
+    static bool Divides(span<const DataT> u)
+    {
+      return Mod(u) == 0;
+    }
+
+    // u ← u / D for a multiple u of D, from the low end: the factor 2^Twos
+    // is shifted out on the fly and each limb of u / 2^Twos is multiplied by
+    // Odd⁻¹ mod B, so no step waits on a division.
+    static void DivideExactTo(vector<DataT> &u)
+    {
+      if constexpr ((LimbBits == 64 || Odd <= LimbMask) && Twos < (int)LimbBits)
+      {
+        SizeT n = (SizeT)u.size();
+        ULong borrow = 0;
+        for (SizeT i = 0; i < n; ++i)
+        {
+          DataT x = u[i];
+          if constexpr (Twos != 0)
+          {
+            DataT next = i + 1 < n ? u[i + 1] : 0;
+            x = ((x >> Twos) | (next << (LimbBits - Twos))) & LimbMask;
+          }
+          DataT s = (x - borrow) & LimbMask;
+          ULong under = x < borrow;
+          DataT q = (s * OddInverse) & LimbMask;
+          u[i] = q;
+          borrow = (ULong)(((ULong128)q * Odd) >> LimbBits) + under;
+        }
+        while (u.size() > 1 && u.back() == 0)
+          u.pop_back();
+      }
+      else
+      {
+        DivModTo(u);
+      }
+    }
+
+  private:
+    // r ← (r·B + limb) mod D; returns the quotient limb.
+    static inline ULong Step(ULong &r, DataT limb)
+    {
+      if constexpr (LimbBits == 64)
+        return DivMod(r, limb, r);
+      else
+      {
+        ULong128 acc = ((ULong128)r << 32) | limb;
+        return DivMod((ULong)(acc >> 64), (ULong)acc, r);
+      }
+    }
+
+    static constexpr ULong OddInverse = ConstantDivision::InverseOdd(Odd);
+    static constexpr ConstantDivision::FoldTable Fold{D};
+  };
+}
+
+#endif
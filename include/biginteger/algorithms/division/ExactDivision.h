@@ -0,0 +1,76 @@
+/**
+ * BigMath: Exact division when the remainder is known to be zero.
+ *
+ * Bidirectional, whose high half goes through the division dispatcher, is
+ * defined with the dispatcher in src/algorithms/Division.cpp.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef EXACT_DIVISION
+#define EXACT_DIVISION
+
+#include <vector>
+using namespace std;
+
+#include "../../common/Util.h"
+#include "../Bitwise.h"
+#include "../Shift.h"
+#include "HenselDivision.h"
+
+// Quotient limbs from which the two-sided (Jebelean) split is used.
+#ifndef BIGMATH_EXACT_BIDIRECTIONAL_THRESHOLD
+#define BIGMATH_EXACT_BIDIRECTIONAL_THRESHOLD 48
+#endif
+
+namespace BigMath
+{
+  // Exact division: q = a / b for a known multiple a of b.
+  //
+  // After the common factor 2^z is shifted out b is odd, so it is a unit
+  // modulo B and q ≡ a · b⁻¹ (mod B^nq) determines q, nq = na − nb + 1 limbs.
+  // Hensel division reads only the low nq limbs of a and b, and quotient
+  // limbs come out lowest first without estimates or corrections.
+  //   - Hensel: the quotient from HenselDivision alone.
+  //   - Bidirectional: the low half of q by Hensel, the high half by
+  //     dividing truncated operands; one overlapping limb decides the ±1
+  //     the truncation leaves in the high half. In the quadratic range each
+  //     side is a quarter of the basecase work; beyond it the high half
+  //     goes through the subquadratic dispatcher.
+  // The result is unspecified when b does not divide a.
+  class ExactDivision
+  {
+  public:
+    static vector<DataT> Divide(vector<DataT> const &a, vector<DataT> const &b)
+    {
+      // Strip the factor 2^z of b, and the matching zeros of a.
+      ULong z = TrailingZeroBits(b);
+      if (z == 0)
+        return DivideOdd(a, b);
+      return DivideOdd(ShiftRightBits(a, z), ShiftRightBits(b, z));
+    }
+
+  private:
+    // Odd b; a and b trimmed.
+    static vector<DataT> DivideOdd(vector<DataT> const &a, vector<DataT> const &b)
+    {
+      SizeT na = (SizeT)a.size();
+      SizeT nb = (SizeT)b.size();
+      if (na < nb)
+        return vector<DataT>{0};
+
+      // A divisor shorter than half the quotient gains nothing from the
+      // split: both sides would run over all of b.
+      SizeT nq = na - nb + 1;
+      vector<DataT> q = nq >= BIGMATH_EXACT_BIDIRECTIONAL_THRESHOLD && nb > nq / 2 + 3
+                            ? Bidirectional(a, b, nq)
+                            : HenselDivision::Quotient(a, b, nq);
+      TrimZerosToOne(q);
+      return q;
+    }
+
+    static vector<DataT> Bidirectional(vector<DataT> const &a, vector<DataT> const &b, SizeT nq);
+  };
+}
+
+#endif
@@ -337,11 +337,14 @@ namespace BigMath
 
   public:
     // Span-based primary entry. Zero-copy for read-only inputs; internal u/v/q/r vectors hold mutable state.
+    // computeQuotient = false leaves the quotient empty and skips storing
+    // its digits (Remainder).
     static pair<vector<DataT>, vector<DataT>> DivideAndRemainder(
         span<const DataT> a,
         span<const DataT> b,
         BaseT base,
-        bool computeRemainder = true)
+        bool computeRemainder = true,
+        bool computeQuotient = true)
     {
       if (IsZero(b))
         throw invalid_argument("Division by zero");
@@ -357,6 +360,8 @@ namespace BigMath
 
       if (b.size() == 1)
       {
+        if (!computeQuotient)
+          return {vector<DataT>(), vector<DataT>{ClassicDivision::Mod(a, b[0], base)}};
         DataT rem = 0;
         vector<DataT> q = DivideByScalar(a, b[0], base, computeRemainder ? &rem : nullptr);
         return {q, computeRemainder ? vector<DataT>{rem} : vector<DataT>()};
@@ -391,7 +396,7 @@ namespace BigMath
       SizeT m = (SizeT)(u.size() - n);
       u.push_back(0);
 
-      vector<DataT> q(m + 1, 0);
+      vector<DataT> q(computeQuotient ? m + 1 : 0, 0);
 
       bool useMG32 = false;
       bool useMG64 = false;
@@ -416,7 +421,13 @@ namespace BigMath
       for (Int j = (Int)m; j >= 0; --j)
       {
         ULong qhat;
-        if (useMG32)
+        if ((useMG32 || useMG64) && u[j + n] == v[n - 1] && u[j + n - 1] == v[n - 2])
+        {
+          // Outside the 3/2 step's domain (u2, u1) < (d1, d0). With v
+          // normalized the digit is then exactly B − 1.
+          qhat = useMG32 ? 0xFFFFFFFFULL : 0xFFFFFFFFFFFFFFFFULL;
+        }
+        else if (useMG32)
         {
           qhat = (ULong)MGQhat_Base32(
               (DataT)u[j + n], (DataT)u[j + n - 1], (DataT)u[j + n - 2],
@@ -477,10 +488,12 @@ namespace BigMath
           AddBack(u, v, (SizeT)j, base);
         }
 
-        q[j] = (DataT)qhat;
+        if (computeQuotient)
+          q[j] = (DataT)qhat;
       }
 
-      TrimZerosToOne(q);
+      if (computeQuotient)
+        TrimZerosToOne(q);
 
       vector<DataT> r;
       if (computeRemainder)
@@ -495,25 +508,92 @@ namespace BigMath
       return {q, r};
     }
 
+    // Algorithm D on caller-owned limbs in CurrentBase, for recursive
+    // dividers whose leaves must not allocate. v is n ≥ 2 limbs with its top
+    // bit set and u[nu − n, nu) < v. The nu − n quotient limbs go to q and
+    // the remainder is left in u[0, n), with u[n, nu) zeroed.
+    static void DivideNormalizedTo(DataT *q, DataT *u, SizeT nu, DataT const *v, SizeT n)
+    {
+      DataT d1 = v[n - 1], d0 = v[n - 2];
+      ULong inverse = LimbBits == 64 ? Reciprocal3by2_Base64(d1, d0)
+                                     : Reciprocal3by2_Base32(d1, d0);
+      for (SizeT j = nu - n; j-- > 0;)
+      {
+        DataT u2 = u[j + n], u1 = u[j + n - 1], u0 = u[j + n - 2];
+        // The 3/2 step needs (u2, u1) < (d1, d0); on equality the digit is
+        // exactly B − 1.
+        ULong qhat;
+        if (u2 == d1 && u1 == d0)
+          qhat = LimbMask;
+        else if (LimbBits == 64)
+          qhat = MGQhat_Base64(u2, u1, u0, d1, d0, inverse);
+        else
+          qhat = MGQhat_Base32(u2, u1, u0, d1, d0, (DataT)inverse);
+
+        q[j] = (DataT)qhat;
+        if (qhat == 0)
+          continue;
+
+        ULong borrow = 0;
+        for (SizeT i = 0; i < n; ++i)
+        {
+          ULong128 p = (ULong128)qhat * v[i] + borrow;
+          DataT low = (DataT)p & LimbMask;
+          borrow = (ULong)(p >> LimbBits);
+          DataT x = u[j + i];
+          borrow += x < low;
+          u[j + i] = (x - low) & LimbMask;
+        }
+        bool negative = u2 < borrow;
+        u[j + n] = (u2 - borrow) & LimbMask;
+
+        while (negative)
+        {
+          --q[j];
+          ULong carry = 0;
+          for (SizeT i = 0; i < n; ++i)
+          {
+            ULong128 s = (ULong128)u[j + i] + v[i] + carry;
+            u[j + i] = (DataT)s & LimbMask;
+            carry = (ULong)(s >> LimbBits);
+          }
+          ULong128 top = (ULong128)u[j + n] + carry;
+          u[j + n] = (DataT)top & LimbMask;
+          negative = (top >> LimbBits) == 0;
+        }
+      }
+    }
+
     static vector<DataT> Divide(span<const DataT> a, span<const DataT> b, BaseT base)
     {
       return DivideAndRemainder(a, b, base, false).first;
     }
 
+    static vector<DataT> Remainder(span<const DataT> a, span<const DataT> b, BaseT base)
+    {
+      return DivideAndRemainder(a, b, base, true, false).second;
+    }
+
     // Vector overloads — thin wrappers for backward compatibility.
     static pair<vector<DataT>, vector<DataT>> DivideAndRemainder(
         vector<DataT> const &a,
         vector<DataT> const &b,
         BaseT base,
-        bool computeRemainder = true)
+        bool computeRemainder = true,
+        bool computeQuotient = true)
     {
-      return DivideAndRemainder(span<const DataT>(a), span<const DataT>(b), base, computeRemainder);
+      return DivideAndRemainder(span<const DataT>(a), span<const DataT>(b), base, computeRemainder, computeQuotient);
     }
 
     static vector<DataT> Divide(vector<DataT> const &a, vector<DataT> const &b, BaseT base)
     {
       return DivideAndRemainder(a, b, base, false).first;
     }
+
+    static vector<DataT> Remainder(vector<DataT> const &a, vector<DataT> const &b, BaseT base)
+    {
+      return DivideAndRemainder(a, b, base, true, false).second;
+    }
   };
 }
 
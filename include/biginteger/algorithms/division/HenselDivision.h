@@ -0,0 +1,310 @@
+/**
+ * BigMath: Hensel (right-to-left) division by odd divisors.
+ *
+ * Finish, the one step that falls back to the division dispatcher, is
+ * defined with the dispatcher in src/algorithms/Division.cpp.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef HENSEL_DIVISION
+#define HENSEL_DIVISION
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+#include "../../common/Comparator.h"
+#include "../../common/Util.h"
+#include "../Bitwise.h"
+#include "../Multiplication.h"
+#include "../Subtraction.h"
+
+// Limbs from which the Hensel quotient splits into halves instead of
+// running the basecase, and from which it multiplies by b⁻¹ mod B^k from a
+// 2-adic Newton iteration instead of splitting.
+#ifndef BIGMATH_HENSEL_DC_THRESHOLD
+#define BIGMATH_HENSEL_DC_THRESHOLD 160
+#endif
+
+#ifndef BIGMATH_HENSEL_NEWTON_THRESHOLD
+#define BIGMATH_HENSEL_NEWTON_THRESHOLD 8192
+#endif
+
+namespace BigMath
+{
+  // Hensel (right-to-left) division by an odd divisor.
+  //
+  // Odd b is a unit modulo B, so q_i = r_i · b⁻¹ mod B clears limb i of the
+  // running remainder exactly: no estimate, no correction. After k limbs
+  //   a = q·b + r·B^k,   0 ≤ q < B^k,
+  // so q ≡ a / b (mod B^k), the quotient when b divides a, and
+  // r ≡ a·B^−k (mod b), the REDC of Montgomery reduction.
+  //   - Basecase: one quotient limb per row, O(k · nb).
+  //   - Divide and conquer: the low half of q, then the high half from
+  //     a − q_low·b; one k/2 × k product per level.
+  //   - Inverse: q = a·b⁻¹ mod B^k with b⁻¹ mod B^k from 2-adic Newton;
+  //     Divider keeps it for repeated division by one b.
+  class HenselDivision
+  {
+  public:
+    static const SizeT HENSEL_DC_THRESHOLD = BIGMATH_HENSEL_DC_THRESHOLD;
+    static const SizeT HENSEL_NEWTON_THRESHOLD = BIGMATH_HENSEL_NEWTON_THRESHOLD;
+
+    // b⁻¹ mod 2^LimbBits for odd b. b·b ≡ 1 (mod 8), and each Newton step
+    // x ← x(2 − b·x) doubles the correct bits: 3 → 6 → 12 → 24 → 48 → 96.
+    static DataT InverseLimb(DataT b)
+    {
+      ULong x = b;
+      for (int i = 0; i < 5; ++i)
+        x *= 2 - (ULong)b * x;
+      return (DataT)(x & LimbMask);
+    }
+
+    // b⁻¹ mod B^k for odd b[0], as k limbs.
+    static vector<DataT> Inverse(span<const DataT> b, SizeT k)
+    {
+      vector<DataT> x{InverseLimb(b[0])};
+      SizeT cur = 1;
+      while (cur < k)
+      {
+        SizeT next = std::min(2 * cur, k);
+        // b·x ≡ 1 + B^cur·u (mod B^next); then x − B^cur·(x·u) is b⁻¹ mod
+        // B^next, and only its upper next − cur limbs are new.
+        vector<DataT> bLow(b.begin(), b.begin() + std::min<SizeT>(next, (SizeT)b.size()));
+        TrimZerosToOne(bLow);
+        TrimZerosToOne(x);
+        vector<DataT> t = Multiply(bLow, x, CurrentBase);
+        t.resize(next, 0);
+        vector<DataT> u(t.begin() + cur, t.end());
+        TrimZerosToOne(u);
+        vector<DataT> v = Multiply(x, u, CurrentBase);
+        v.resize(next - cur, 0);
+        NegateTo(v.data(), next - cur);
+        x.resize(cur, 0);
+        x.insert(x.end(), v.begin(), v.end());
+        cur = next;
+      }
+      return x;
+    }
+
+    // q[0..k) ← a · b⁻¹ mod B^k, r holding a's low k limbs (consumed).
+    static void QuotientTo(DataT *q, DataT *r, span<const DataT> b, SizeT k, DataT inverse)
+    {
+      SizeT nb = std::min(k, (SizeT)b.size());
+      if (nb < HENSEL_DC_THRESHOLD)
+      {
+        Basecase(q, r, b.first(nb), k, inverse);
+        return;
+      }
+
+      if (nb >= HENSEL_NEWTON_THRESHOLD)
+      {
+        vector<DataT> x = Inverse(b.first(nb), k);
+        MultiplyLowTo(q, r, x, k);
+        return;
+      }
+
+      SizeT k1 = k / 2;
+      QuotientTo(q, r, b, k1, inverse);
+
+      vector<DataT> qLow(q, q + k1), bLow(b.begin(), b.begin() + nb);
+      TrimZerosToOne(qLow);
+      TrimZerosToOne(bLow);
+      vector<DataT> t = Multiply(qLow, bLow, CurrentBase);
+      t.resize(k, 0);
+      ULong borrow = 0;
+      for (SizeT i = k1; i < k; ++i)
+      {
+        DataT d = (r[i] - t[i]) & LimbMask;
+        ULong under = r[i] < t[i];
+        r[i] = (d - borrow) & LimbMask;
+        borrow = under | (d < borrow);
+      }
+
+      QuotientTo(q + k1, r + k1, b, k - k1, inverse);
+    }
+
+    // a · b⁻¹ mod B^k as k limbs, for odd b.
+    static vector<DataT> Quotient(span<const DataT> a, span<const DataT> b, SizeT k)
+    {
+      vector<DataT> r(k, 0);
+      std::copy(a.begin(), a.begin() + std::min<SizeT>(k, (SizeT)a.size()), r.begin());
+      vector<DataT> q(k, 0);
+      QuotientTo(q.data(), r.data(), b, k, InverseLimb(b[0]));
+      return q;
+    }
+
+    // a · B^−k mod b in [0, b), for odd b.
+    static vector<DataT> Reduce(vector<DataT> const &a, vector<DataT> const &b, SizeT k)
+    {
+      CheckDivisor(b);
+      if (std::min<SizeT>(k, (SizeT)b.size()) < HENSEL_DC_THRESHOLD)
+        return ReduceBasecase(a, b, k);
+      return ReduceWithQuotient(a, b, Quotient(a, b, k), k);
+    }
+
+    // Odd divisor with b⁻¹ mod B^k computed once: each quotient is then a
+    // single low product, each reduction one more.
+    class Divider
+    {
+    private:
+      vector<DataT> divisor;
+      vector<DataT> inverse;
+      SizeT k;
+
+    public:
+      Divider(vector<DataT> const &b, SizeT limbs) : divisor(b), k(limbs)
+      {
+        TrimZeros(divisor);
+        CheckDivisor(divisor);
+        if (k >= HENSEL_DC_THRESHOLD)
+          inverse = Inverse(divisor, k);
+      }
+
+      // a · b⁻¹ mod B^k as k limbs.
+      vector<DataT> Quotient(vector<DataT> const &a) const
+      {
+        if (inverse.empty())
+          return HenselDivision::Quotient(a, divisor, k);
+        vector<DataT> q(k, 0);
+        MultiplyLowTo(q.data(), a.data(), inverse, std::min(k, (SizeT)a.size()), k);
+        return q;
+      }
+
+      // a · B^−k mod b in [0, b).
+      vector<DataT> Reduce(vector<DataT> const &a) const
+      {
+        if (inverse.empty())
+          return HenselDivision::Reduce(a, divisor, k);
+        return ReduceWithQuotient(a, divisor, Quotient(a), k);
+      }
+
+      vector<DataT> const &Divisor() const
+      {
+        return divisor;
+      }
+
+      SizeT Limbs() const
+      {
+        return k;
+      }
+    };
+
+  private:
+    static void CheckDivisor(vector<DataT> const &b)
+    {
+      if (IsZero(b))
+        throw invalid_argument("Division by zero");
+      if ((b[0] & 1) == 0)
+        throw invalid_argument("Hensel divisor must be odd");
+    }
+
+    // q[0..k) ← (a[0..na) · x) mod B^k.
+    static void MultiplyLowTo(DataT *q, DataT const *a, vector<DataT> const &x, SizeT na, SizeT k)
+    {
+      vector<DataT> y(a, a + na), xLow(x.begin(), x.begin() + std::min(k, (SizeT)x.size()));
+      TrimZerosToOne(y);
+      TrimZerosToOne(xLow);
+      vector<DataT> p = Multiply(y, xLow, CurrentBase);
+      p.resize(k, 0);
+      std::copy(p.begin(), p.end(), q);
+    }
+
+    static void MultiplyLowTo(DataT *q, DataT const *r, vector<DataT> const &x, SizeT k)
+    {
+      MultiplyLowTo(q, r, x, k, k);
+    }
+
+    // Basecase of the Hensel quotient: O(k · nb).
+    static void Basecase(DataT *q, DataT *r, span<const DataT> b, SizeT k, DataT inverse)
+    {
+      SizeT nb = (SizeT)b.size();
+      if (nb == 1)
+      {
+        // One limb: the running borrow is a single limb.
+        DataT d = b[0];
+        ULong borrow = 0;
+        for (SizeT i = 0; i < k; ++i)
+        {
+          DataT s = (r[i] - borrow) & LimbMask;
+          ULong under = r[i] < borrow;
+          q[i] = (s * inverse) & LimbMask;
+          ULong128 p = (ULong128)q[i] * d;
+          borrow = (ULong)(p >> LimbBits) + under;
+        }
+        return;
+      }
+
+      for (SizeT i = 0; i < k; ++i)
+      {
+        DataT qi = (r[i] * inverse) & LimbMask;
+        q[i] = qi;
+        SubtractRow(r, i, k, qi, b);
+      }
+    }
+
+    // r −= qi·b·B^i over limbs [i, len); returns the borrow out of limb len.
+    static ULong SubtractRow(DataT *r, SizeT i, SizeT len, DataT qi, span<const DataT> b)
+    {
+      SizeT n = std::min((SizeT)b.size(), len - i);
+      ULong borrow = 0;
+      for (SizeT j = 0; j < n; ++j)
+      {
+        ULong128 p = (ULong128)qi * b[j] + borrow;
+        DataT low = (DataT)p & LimbMask;
+        borrow = (ULong)(p >> LimbBits);
+        DataT x = r[i + j];
+        borrow += x < low;
+        r[i + j] = (x - low) & LimbMask;
+      }
+      for (SizeT j = i + n; borrow != 0 && j < len; ++j)
+      {
+        DataT x = r[j];
+        r[j] = (x - borrow) & LimbMask;
+        borrow = x < borrow;
+      }
+      return borrow;
+    }
+
+    // (a − q·b) / B^k into [0, b), given the sign of a − q·b.
+    static vector<DataT> Finish(vector<DataT> r, bool negative, vector<DataT> const &b);
+
+    // One row per quotient limb over the full width of a, as in word-by-word
+    // REDC; the borrows out of the top give the sign of a − q·b.
+    static vector<DataT> ReduceBasecase(vector<DataT> const &a, vector<DataT> const &b, SizeT k)
+    {
+      SizeT nb = (SizeT)b.size();
+      SizeT len = std::max((SizeT)a.size(), k + nb);
+      vector<DataT> r(len, 0);
+      std::copy(a.begin(), a.end(), r.begin());
+      DataT inverse = InverseLimb(b[0]);
+      ULong out = 0;
+      for (SizeT i = 0; i < k; ++i)
+        out += SubtractRow(r.data(), i, len, (r[i] * inverse) & LimbMask, b);
+
+      // With out set the top holds B^(len−k) − |a − q·b| / B^k.
+      vector<DataT> high(r.begin() + k, r.end());
+      if (out != 0)
+        NegateTo(high.data(), (SizeT)high.size());
+      return Finish(std::move(high), out != 0, b);
+    }
+
+    static vector<DataT> ReduceWithQuotient(vector<DataT> const &a, vector<DataT> const &b,
+                                            vector<DataT> q, SizeT k)
+    {
+      TrimZerosToOne(q);
+      vector<DataT> t = Multiply(q, b, CurrentBase);
+      TrimZerosToOne(t);
+      bool negative = Compare(a, t) < 0;
+      vector<DataT> d = negative ? t : a;
+      SubtractFrom(d, negative ? a : t, CurrentBase);
+      d.erase(d.begin(), d.begin() + std::min(k, (SizeT)d.size()));
+      return Finish(std::move(d), negative, b);
+    }
+  };
+}
+
+#endif
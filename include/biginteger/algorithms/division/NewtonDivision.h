@@ -2,32 +2,47 @@
 #define NEWTON_DIVISION
 
 #include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <cstring>
+#include <span>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 using namespace std;
 
 #include "../../common/Comparator.h"
+#include "../../common/Parallel.h"
 #include "../../common/Util.h"
 #include "../Addition.h"
 #include "../Multiplication.h"
+#include "../Shift.h"
 #include "../Subtraction.h"
 #include "ClassicDivision.h"
 #include "FastDivision.h"
 
+// Fewest n-limb blocks per segment when a blockwise division is cut into
+// segments for the thread pool.
+#ifndef BIGMATH_NEWTON_PARALLEL_SEGMENT_BLOCKS
+#define BIGMATH_NEWTON_PARALLEL_SEGMENT_BLOCKS 4
+#endif
+
 namespace BigMath
 {
   // Newton-Raphson division.
   // Precomputes an n-limb approximate reciprocal R of the normalized divisor D
-  // such that R*D ≈ B^(2n). For na ≤ 2n+1: one Q = (a*R) >> 2n + small fixup.
-  // For na > 2n+1: blockwise — process top first_chunk ∈ [n+1, 2n] limbs, then slide down
+  // such that R*D ≈ B^(2n). For na ≤ 2n: one Q = (a*R) >> 2n + small fixup.
+  // For na > 2n: blockwise — process top first_chunk ∈ [n+1, 2n] limbs, then slide down
   // by n, threading the remainder as the high part of each next chunk. Cost stays O(M(n))
   // per block, so blockwise total = (na/n) · M(n) ≈ O(M(na)) — beats Knuth's O(na·n) and
-  // BZ's O(M(na)·log) at sizes where M(n) is NTT-dominated.
+  // BZ's O(M(na)·log) at sizes where M(n) is NTT-dominated. Products whose high part is
+  // known to cancel (Q·D against the chunk, D·R against B^2n) are taken modulo B^K − 1
+  // on half-length transforms.
   class NewtonDivision
   {
   private:
+    static const SizeT NEWTON_PARALLEL_SEGMENT_BLOCKS = BIGMATH_NEWTON_PARALLEL_SEGMENT_BLOCKS;
+
     struct ScratchBuffers
     {
       vector<DataT> v0;
@@ -46,61 +61,68 @@ namespace BigMath
       return scratch;
     }
 
-    // Bit-shift left by `bits` in [0, LimbBits-1].
-    static vector<DataT> ShiftLeftBits(vector<DataT> const &v, Int bits)
+    // Whether products of `limbs` total limbs go through the NTT, where
+    // prepared spectra and wrap-around products pay off.
+    static bool UseNtt(SizeT limbs)
     {
-      if (bits == 0 || IsZero(v))
-        return v;
-      vector<DataT> out(v.size() + 1, 0);
-      for (SizeT i = 0; i < v.size(); ++i)
-      {
-#if BIGMATH_LIMB_64
-        ULong128 cur = (ULong128)v[i] << bits;
-        out[i] |= (DataT)(cur & 0xFFFFFFFFFFFFFFFFULL);
-        out[i + 1] |= (DataT)(cur >> 64);
-#else
-        ULong cur = (ULong)v[i] << bits;
-        out[i] |= (DataT)(cur & 0xFFFFFFFFULL);
-        out[i + 1] |= (DataT)(cur >> 32);
-#endif
-      }
-      TrimZerosToOne(out);
-      return out;
+      return limbs >= NTT_MULTIPLICATION_THRESHOLD &&
+             (CurrentBase == Base2_32 || CurrentBase == Base2_64);
+    }
+
+    // a·b mod (B^K − 1) as K limbs, for a and b of at most K limbs.
+    static vector<DataT> MultiplyWrap(vector<DataT> const &a, vector<DataT> const &b, SizeT K)
+    {
+      if (UseNtt((SizeT)(a.size() + b.size())))
+        return NTTMultiplication::MultiplyWrap(NTTMultiplication::PrepareWrap(a, K, CurrentBase), b);
+      return NTTMultiplication::FoldWrap(Multiply(a, b, CurrentBase), K, CurrentBase);
     }
 
-    // Bit-shift right by `bits` in [0, LimbBits-1].
-    static vector<DataT> ShiftRightBits(vector<DataT> const &v, Int bits)
+    // (c − w) mod (B^K − 1) for K-limb c and w.
+    static vector<DataT> WrapSubtract(vector<DataT> const &c, vector<DataT> const &w)
     {
-      if (bits == 0 || IsZero(v))
-        return v;
-      vector<DataT> out(v.size(), 0);
-      for (Int i = 0; i < (Int)v.size(); ++i)
+      SizeT K = (SizeT)c.size();
+      vector<DataT> y(K);
+      ULong borrow = 0;
+      for (SizeT i = 0; i < K; ++i)
       {
-#if BIGMATH_LIMB_64
-        ULong128 cur = (ULong128)v[i];
-        if (i + 1 < (Int)v.size())
-          cur |= ((ULong128)v[i + 1]) << 64;
-        out[i] = (DataT)((cur >> bits) & 0xFFFFFFFFFFFFFFFFULL);
-#else
-        ULong cur = v[i];
-        if (i + 1 < (Int)v.size())
-          cur |= ((ULong)v[i + 1]) << 32;
-        out[i] = (DataT)((cur >> bits) & 0xFFFFFFFFULL);
-#endif
+        ULong128 t = (ULong128)c[i] - w[i] - borrow;
+        y[i] = (DataT)((ULong)t & LimbMask);
+        borrow = (ULong)(t >> 127);
       }
-      TrimZerosToOne(out);
-      return out;
+      // −B^K ≡ −1.
+      for (SizeT i = 0; borrow != 0 && i < K; ++i)
+      {
+        borrow = y[i] == 0;
+        y[i] = (y[i] - 1) & LimbMask;
+      }
+      return y;
+    }
+
+    // The x with |x| < B^(K−1) and x ≡ y (mod B^K − 1): returns |x| and sets
+    // `negative`. A negative x leaves y's top limb all ones, a positive one
+    // leaves it zero.
+    static vector<DataT> Unwrap(vector<DataT> y, bool &negative)
+    {
+      negative = y.back() != 0;
+      if (negative)
+        for (DataT &limb : y)
+          limb = ~limb & LimbMask;
+      TrimZerosToOne(y);
+      if (IsZero(y))
+        negative = false;
+      return y;
     }
 
     // ApproxReciprocal: given n-limb normalized D (top bit of D[n-1] set),
     // returns R such that R*D ≈ B^(2n), off by at most a small constant.
     // R has up to n+1 limbs. Implementation: 2-limb hardware seed, then
-    // precision-doubling Newton iteration R_new = R * (2S - D*R) / S.
+    // precision-doubling Newton iteration R_new = R * (2S - D*R) / S, with
+    // D*R wrapped and only the significant limbs of 2S - D*R kept.
     //
     // `high_precision`: when true, run one extra Newton iter at full precision after main
     // convergence. Doubles the correct-bit count (Newton is quadratic) — needed only when
-    // the caller will use R against an `a` of size 2n+1 (the +1-limb bump band from the
-    // normalize shift). Skipped otherwise to avoid a ~20% cost on the common case.
+    // the caller will use R against chunks of a full 2n limbs. Skipped otherwise to avoid
+    // a ~20% cost on the common case.
     static vector<DataT> ApproxReciprocal(vector<DataT> const &D, bool high_precision = false)
     {
       SizeT n = (SizeT)D.size();
@@ -108,9 +130,9 @@ namespace BigMath
       vector<DataT> &R_pad = scratch.v0;
       vector<DataT> &D_new = scratch.v1;
       vector<DataT> &T = scratch.v2;
-      vector<DataT> &two_S = scratch.v3;
-      vector<DataT> &diff = scratch.v4;
-      vector<DataT> &RD = scratch.v5;
+      vector<DataT> &correction = scratch.v3;
+      vector<DataT> &E = scratch.v4;
+      vector<DataT> &RE = scratch.v5;
 
       // n == 1 base case: R ≈ B^2 / D[0].
       if (n == 1)
@@ -184,39 +206,38 @@ namespace BigMath
           ++extra_iters_done;
         }
 
-        // Pad R as seed at new_n precision: shift up by (new_n - cur_n) limbs.
-        R_pad.assign(R.size() + extend, 0);
-        std::memcpy(R_pad.data() + extend, R.data(), R.size() * sizeof(DataT));
-
-        // D_new = top new_n limbs of D.
-        D_new.assign(D.begin() + (n - new_n), D.end());
-
-        // T = D_new * R_pad
-        T = Multiply(D_new, R_pad, CurrentBase);
-
-        // diff = 2*B^(2*new_n) - T  (should be ≥ 0 for valid seeds).
-        two_S.assign(2 * new_n + 1, 0);
-        two_S[2 * new_n] = 2;
-
-        if (Compare(two_S, T) >= 0)
-        {
-          diff = Subtract(two_S, T, CurrentBase);
-        }
+        // With R_pad = R·B^extend, the step R_pad·(2B^(2m) − D_new·R_pad) / B^(2m)
+        // (m = new_n, c = cur_n) equals R_pad + R·E / B^(2c) for
+        // E = B^(m+c) − D_new·R. |E| < B^(m+1): the top of D_new·R cancels
+        // against B^(m+c), so that product is only needed modulo B^K − 1 for
+        // K ≥ m + 2, half the transform of the full product. Limbs of E below
+        // c − 1 move the result by under one unit and are dropped before R·E.
+        SizeT m = new_n, c = cur_n;
+
+        // D_new = top m limbs of D.
+        D_new.assign(D.begin() + (n - m), D.end());
+
+        SizeT K = NTTMultiplication::WrapLimbs(m + 2, CurrentBase);
+        T.assign(K, 0);
+        T[(m + c) % K] = 1;
+        bool negative = false;
+        E = Unwrap(WrapSubtract(T, MultiplyWrap(D_new, R, K)), negative);
+        if (E.size() > c - 1)
+          E.erase(E.begin(), E.begin() + (c - 1));
         else
-        {
-          // R was over-estimate; shouldn't normally trigger. Clamp to 0.
-          diff.assign(1, 0);
-        }
+          E.assign(1, 0);
 
-        // R_new = (R_pad * diff) >> (32 * 2 * new_n)
-        RD = Multiply(R_pad, diff, CurrentBase);
-        if (RD.size() > 2 * new_n)
+        RE = Multiply(R, E, CurrentBase);
+        R_pad.assign(R.size() + extend, 0);
+        std::memcpy(R_pad.data() + extend, R.data(), R.size() * sizeof(DataT));
+        if (RE.size() > c + 1)
         {
-          R.assign(RD.begin() + 2 * new_n, RD.end());
+          correction.assign(RE.begin() + (c + 1), RE.end());
+          R = negative ? Subtract(R_pad, correction, CurrentBase) : Add(R_pad, correction, CurrentBase);
         }
         else
         {
-          R = vector<DataT>{0};
+          R = R_pad;
         }
         TrimZerosToOne(R);
 
@@ -226,6 +247,70 @@ namespace BigMath
       return R;
     }
 
+    // R, and what every block needs from it. D is normalized, so
+    // B^n < R ≤ 2B^n and R = B^n + RLow with RLow below B^n (clamped at the
+    // top, which moves estimates by at most one): the Q estimate is an n×n
+    // product. The remainder check needs Q·D only modulo B^K − 1. In the NTT
+    // range the spectra of both fixed operands are prepared here once, so
+    // each block pays one forward and one inverse transform per product.
+    struct Reciprocal
+    {
+      vector<DataT> R;
+      vector<DataT> RLow;
+      SizeT K = 0;
+      bool prepared = false;
+      NTTMultiplication::PreparedOperand preparedRLow;
+      NTTMultiplication::PreparedOperand preparedDivisor;
+
+      Reciprocal() = default;
+
+      Reciprocal(vector<DataT> const &b_norm, bool high_precision)
+          : Reciprocal(ApproxReciprocal(b_norm, high_precision), b_norm, true)
+      {
+      }
+
+      // From a reciprocal computed earlier; the transforms are left for the
+      // caller when prepare is false.
+      Reciprocal(vector<DataT> r, vector<DataT> const &b_norm, bool prepare)
+          : R(std::move(r))
+      {
+        SizeT n = (SizeT)b_norm.size();
+        if (R.size() <= n)
+          RLow.assign(1, 0);
+        else if (R.size() == n + 1 && R[n] == 1)
+          RLow.assign(R.begin(), R.begin() + n);
+        else
+          RLow.assign(n, LimbMask);
+        TrimZerosToOne(RLow);
+
+        K = NTTMultiplication::WrapLimbs(n + 2, CurrentBase);
+        prepared = UseNtt(2 * n);
+        if (prepared && prepare)
+        {
+          preparedRLow = NTTMultiplication::PrepareOperand(RLow, n, CurrentBase);
+          preparedDivisor = NTTMultiplication::PrepareWrap(b_norm, K, CurrentBase);
+        }
+      }
+
+      // high · RLow for high of at most n limbs.
+      vector<DataT> MultiplyLow(vector<DataT> const &high) const
+      {
+        if (!prepared || high.size() > preparedRLow.maxOtherLimbs || preparedRLow.Empty())
+          return Multiply(high, RLow, CurrentBase);
+        vector<DataT> p = NTTMultiplication::Multiply(preparedRLow, high);
+        TrimZerosToOne(p);
+        return p;
+      }
+
+      // q · b_norm mod (B^K − 1).
+      vector<DataT> MultiplyDivisorWrap(vector<DataT> const &q, vector<DataT> const &b_norm) const
+      {
+        if (!prepared)
+          return MultiplyWrap(q, b_norm, K);
+        return NTTMultiplication::MultiplyWrap(preparedDivisor, q);
+      }
+    };
+
     // Sentinel for "fixup loop blew the cap" — caller should fall back to FastDivision.
     struct DivideResult
     {
@@ -239,36 +324,58 @@ namespace BigMath
     static DivideResult DivideChunk(
         vector<DataT> const &chunk,
         vector<DataT> const &b_norm,
-        vector<DataT> const &R)
+        Reciprocal const &rec)
     {
       SizeT n = (SizeT)b_norm.size();
       auto &scratch = Scratch();
-      vector<DataT> &CR = scratch.v0;
-      vector<DataT> &Q = scratch.v1;
-      vector<DataT> &QB = scratch.v2;
-
-      // Q ≈ (chunk * R) >> (2n limbs)
-      CR = Multiply(chunk, R, CurrentBase);
-      if (CR.size() > 2 * n)
-        Q.assign(CR.begin() + 2 * n, CR.end());
+      vector<DataT> &high = scratch.v0;
+      vector<DataT> &CR = scratch.v1;
+      vector<DataT> &Q = scratch.v2;
+
+      // Q ≈ (chunk · R) >> 2n = high + (high · RLow) >> n for high the limbs
+      // of chunk above B^n. The limbs below move the estimate by less than
+      // R / B^n ≤ 2, inside the fixup below.
+      if (chunk.size() > n)
+        high.assign(chunk.begin() + n, chunk.end());
+      else
+        high.assign(1, 0);
+      CR = rec.MultiplyLow(high);
+      if (CR.size() > n)
+      {
+        CR.erase(CR.begin(), CR.begin() + n);
+        Q = Add(high, CR, CurrentBase);
+      }
       else
-        Q.assign(1, 0);
+      {
+        Q = high;
+      }
       TrimZerosToOne(Q);
 
-      QB = Multiply(Q, b_norm, CurrentBase);
+      // |chunk − Q·D| < B^(n+1) ≤ B^(K−1), so the product wraps losslessly.
+      bool negative = false;
+      vector<DataT> rem = Unwrap(
+          WrapSubtract(NTTMultiplication::FoldWrap(chunk, rec.K, CurrentBase), rec.MultiplyDivisorWrap(Q, b_norm)),
+          negative);
 
       const int FIXUP_LIMIT = 8;
       static const vector<DataT> one{1};
 
       int iters = 0;
-      while (Compare(QB, chunk) > 0)
+      while (negative)
       {
         if (++iters > FIXUP_LIMIT)
           return {{}, {}, false};
         Q = Subtract(Q, one, CurrentBase);
-        QB = Subtract(QB, b_norm, CurrentBase);
+        if (Compare(rem, b_norm) <= 0)
+        {
+          rem = Subtract(b_norm, rem, CurrentBase);
+          negative = false;
+        }
+        else
+        {
+          rem = Subtract(rem, b_norm, CurrentBase);
+        }
       }
-      vector<DataT> rem = Subtract(chunk, QB, CurrentBase);
 
       iters = 0;
       while (Compare(rem, b_norm) >= 0)
@@ -279,52 +386,36 @@ namespace BigMath
         Q = Add(Q, one, CurrentBase);
       }
 
+      TrimZerosToOne(rem);
       TrimZerosToOne(Q);
 
       return {Q, rem, true};
     }
 
-    static pair<vector<DataT>, vector<DataT>> DivideNormalizedWithReciprocal(
-        vector<DataT> const &a,
-        vector<DataT> const &b,
-        BaseT base,
-        Int shift,
-        vector<DataT> const &a_norm,
+    // Blockwise division of a normalized x: the top chunk of n+1 to 2n
+    // limbs, then one n-limb block at a time below the previous remainder.
+    // Without computeQuotient the block quotients are never assembled.
+    static DivideResult DivideBlocks(
+        vector<DataT> const &x,
         vector<DataT> const &b_norm,
-        vector<DataT> const &R,
-        bool computeRemainder = true)
+        Reciprocal const &R,
+        bool computeQuotient)
     {
       SizeT n = (SizeT)b_norm.size();
-      SizeT na = (SizeT)a_norm.size();
+      SizeT na = (SizeT)x.size();
+      if (Compare(x, b_norm) < 0)
+        return {vector<DataT>{0}, x, true};
+      if (na <= 2 * n)
+        return DivideChunk(x, b_norm, R);
 
-      // Two paths:
-      //   Single-block (na ≤ 2n+1): one reciprocal-divide on the whole a.
-      //   Blockwise (na > 2n+1): top chunk ∈ [n+1, 2n] limbs, then slide.
-      bool blockwise = (na > 2 * n + 1);
       auto &scratch = Scratch();
       vector<vector<DataT>> &q_pieces = scratch.qPieces;
 
-      if (!blockwise)
-      {
-        DivideResult res = DivideChunk(a_norm, b_norm, R);
-        if (!res.ok)
-          return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-        vector<DataT> rem_final;
-        if (computeRemainder)
-        {
-          rem_final = (shift > 0) ? ShiftRightBits(res.rem, shift) : res.rem;
-          TrimZerosToOne(rem_final);
-        }
-        return {res.q, rem_final};
-      }
-
-      // ----- Blockwise path -----
       // first_chunk_size in [n+1, 2n], chosen so remaining (na - first_chunk_size) is divisible by n.
       // Formula: ((na - 1) mod n) + 1 + n.  Verified for na in {2n+2, 3n, 3n+1, 4n, …}.
       SizeT first_chunk_size = (SizeT)(((na - 1) % n) + 1 + n);
       SizeT pos_low = na - first_chunk_size;
-      vector<DataT> chunk(a_norm.begin() + pos_low, a_norm.end());
+      vector<DataT> chunk(x.begin() + pos_low, x.end());
 
       // Collect Q pieces top-down; reverse-concat at end.
       q_pieces.clear();
@@ -336,40 +427,46 @@ namespace BigMath
       {
         DivideResult res = DivideChunk(chunk, b_norm, R);
         if (!res.ok)
-          return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
+          return {{}, {}, false};
 
         vector<DataT> Q_block = std::move(res.q);
         rem = std::move(res.rem);
 
         // Non-first blocks must contribute exactly n limbs to Q (the n limbs of A consumed).
         // The rem-strict invariant (rem < b_norm) guarantees Q_block.size() ≤ n there.
-        if (!is_first)
+        if (computeQuotient)
         {
-          while (Q_block.size() < n)
-            Q_block.push_back(0);
-          if (Q_block.size() > n)
+          if (!is_first)
           {
-            // Should be unreachable given the invariant — bail defensively.
-            return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
+            while (Q_block.size() < n)
+              Q_block.push_back(0);
+            if (Q_block.size() > n)
+            {
+              // Should be unreachable given the invariant — bail defensively.
+              return {{}, {}, false};
+            }
           }
+          q_pieces.push_back(std::move(Q_block));
         }
-        q_pieces.push_back(std::move(Q_block));
         is_first = false;
 
         if (pos_low == 0)
           break;
 
-        // Build next chunk: high = rem (≤ n limbs), low = a_norm[pos_low - n .. pos_low - 1].
+        // Build next chunk: high = rem (≤ n limbs), low = x[pos_low - n .. pos_low - 1].
         SizeT block_n = n; // by construction, remaining is a multiple of n.
         SizeT next_chunk_size = block_n + (SizeT)rem.size();
         vector<DataT> &next_chunk = scratch.v3;
         next_chunk.assign(next_chunk_size, 0);
-        std::memcpy(next_chunk.data(), a_norm.data() + pos_low - block_n, block_n * sizeof(DataT));
+        std::memcpy(next_chunk.data(), x.data() + pos_low - block_n, block_n * sizeof(DataT));
         std::memcpy(next_chunk.data() + block_n, rem.data(), rem.size() * sizeof(DataT));
         chunk = std::move(next_chunk);
         pos_low -= block_n;
       }
 
+      if (!computeQuotient)
+        return {vector<DataT>(), rem, true};
+
       // Concat q_pieces — first piece (top) goes to high end of final Q.
       SizeT total_q = 0;
       for (auto &p : q_pieces)
@@ -380,27 +477,249 @@ namespace BigMath
         Q.insert(Q.end(), it->begin(), it->end());
       TrimZerosToOne(Q);
 
+      return {Q, rem, true};
+    }
+
+    // The blockwise division cut into segments divided on the pool. The
+    // bottom segments S_g are L = k·n limbs at limb g·L, the top one takes
+    // the rest. Each divides with no incoming remainder, S_g = Q'_g·D + R'_g,
+    // and one more task divides B^L = Y·D + Z. Then only a short chain is
+    // serial: from the top, with r the remainder of the limbs above S_g,
+    //   r·B^L + S_g = (Q'_g + r·Y)·D + r·Z + R'_g,
+    // and r·Z + R'_g < D·B^n is one chunk, c_g·D + r_next. The quotient
+    // segments Q_g = Q'_g + r·Y + c_g < B^L are then formed on the pool.
+    static DivideResult DivideSegments(
+        vector<DataT> const &a_norm,
+        vector<DataT> const &b_norm,
+        Reciprocal const &R,
+        SizeT segments,
+        bool computeQuotient)
+    {
+      SizeT n = (SizeT)b_norm.size();
+      SizeT na = (SizeT)a_norm.size();
+      SizeT L = na / n / segments * n;
+
+      vector<DivideResult> parts(segments + 1);
+      ParallelDo((Int)(segments + 1), [&](Int start, Int end) {
+        for (Int i = start; i < end; ++i)
+        {
+          vector<DataT> x;
+          if ((SizeT)i == segments)
+          {
+            x.assign(L + 1, 0);
+            x[L] = 1;
+          }
+          else
+          {
+            SizeT lo = (SizeT)i * L;
+            SizeT hi = (SizeT)i + 1 == segments ? na : lo + L;
+            x.assign(a_norm.begin() + lo, a_norm.begin() + hi);
+            TrimZerosToOne(x);
+          }
+          parts[i] = DivideBlocks(x, b_norm, R, computeQuotient);
+        }
+      });
+      for (auto const &part : parts)
+        if (!part.ok)
+          return {{}, {}, false};
+
+      vector<DataT> const &Y = parts[segments].q;
+      vector<DataT> const &Z = parts[segments].rem;
+      vector<DataT> r = parts[segments - 1].rem;
+      vector<vector<DataT>> incoming(segments - 1), carries(segments - 1);
+      for (SizeT g = segments - 1; g-- > 0;)
+      {
+        vector<DataT> t = Add(Multiply(r, Z, CurrentBase), parts[g].rem, CurrentBase);
+        TrimZerosToOne(t);
+        DivideResult c = DivideChunk(t, b_norm, R);
+        if (!c.ok)
+          return {{}, {}, false};
+        incoming[g] = std::move(r);
+        carries[g] = std::move(c.q);
+        r = std::move(c.rem);
+      }
+      if (!computeQuotient)
+        return {vector<DataT>(), r, true};
+
+      vector<DataT> Q(na, 0);
+      vector<DataT> const &top = parts[segments - 1].q;
+      std::copy(top.begin(), top.begin() + std::min((SizeT)top.size(), na - (segments - 1) * L),
+                Q.begin() + (segments - 1) * L);
+      ParallelDo((Int)(segments - 1), [&](Int start, Int end) {
+        for (Int g = start; g < end; ++g)
+        {
+          vector<DataT> q = Add(Add(parts[g].q, carries[g], CurrentBase),
+                                Multiply(incoming[g], Y, CurrentBase), CurrentBase);
+          std::copy(q.begin(), q.begin() + std::min((SizeT)q.size(), L), Q.begin() + (SizeT)g * L);
+        }
+      });
+      TrimZerosToOne(Q);
+      return {Q, r, true};
+    }
+
+    static pair<vector<DataT>, vector<DataT>> DivideNormalizedWithReciprocal(
+        vector<DataT> const &a,
+        vector<DataT> const &b,
+        BaseT base,
+        Int shift,
+        vector<DataT> const &a_norm,
+        vector<DataT> const &b_norm,
+        Reciprocal const &R,
+        bool computeRemainder = true,
+        bool computeQuotient = true,
+        SizeT workers = 1)
+    {
+      SizeT n = (SizeT)b_norm.size();
+      SizeT na = (SizeT)a_norm.size();
+
+      // Two paths:
+      //   Single-block (na ≤ 2n): one reciprocal-divide on the whole a.
+      //   Blockwise (na > 2n): top chunk ∈ [n+1, 2n] limbs, then slide,
+      //   in up to workers − 1 segments on the pool.
+      // A 2n+1-limb a (an unnormalized 2n-limb a after the shift) is past
+      // R's precision: as one block it overran the fixup and fell back to
+      // FastDivision.
+      SizeT segments = workers > 1 ? std::min(workers - 1, na / n / NEWTON_PARALLEL_SEGMENT_BLOCKS) : 0;
+      DivideResult res = segments >= 2
+                             ? DivideSegments(a_norm, b_norm, R, segments, computeQuotient)
+                             : DivideBlocks(a_norm, b_norm, R, computeQuotient);
+      if (!res.ok)
+        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder, computeQuotient);
+
       vector<DataT> rem_final;
       if (computeRemainder)
       {
-        rem_final = (shift > 0) ? ShiftRightBits(rem, shift) : rem;
+        rem_final = (shift > 0) ? ShiftRightBits(res.rem, shift) : res.rem;
         TrimZerosToOne(rem_final);
       }
-
-      return {Q, rem_final};
+      return {res.q, rem_final};
     }
 
   public:
+    // Divider state as a versioned binary blob, so the reciprocal of a fixed
+    // divisor is built once and reloaded on later runs:
+    //
+    //   header   "BMDV", version, limb bits, flags, base, shift, NTT layout
+    //   divisor  limb count, limbs
+    //   R        limb count, limbs             (Newton dividers)
+    //   spectra  transforms of RLow and b_norm (BlobTransforms)
+    //
+    // Words are in host byte order and each array starts on an 8-byte
+    // boundary, so a blob written to a file can be handed back as the bytes
+    // of an mmap. Loading copies the arrays into the divider and shifts the
+    // divisor once; no Newton step or transform is run unless the blob
+    // lacks the spectra. Blobs from another format version, limb width,
+    // base or byte order are rejected. Spectra from another NTT layout are
+    // dropped and recomputed.
     class Divider
     {
+    public:
+      static constexpr uint32_t BlobVersion = 1;
+      static constexpr uint32_t BlobNewton = 1;
+      static constexpr uint32_t BlobTransforms = 2;
+      static constexpr uint32_t BlobNegative = 4;
+
     private:
+      static constexpr char BlobMagic[4] = {'B', 'M', 'D', 'V'};
+      static constexpr uint32_t NttLayout =
+          BIGMATH_NTT_MFA ? 0x10000u | (std::bit_width((ULong)BIGMATH_NTT_MFA_THRESHOLD) << 8) |
+                                std::bit_width((ULong)BIGMATH_NTT_MFA_LEAF)
+                          : 0;
+
       vector<DataT> divisor;
       vector<DataT> b_norm;
-      vector<DataT> reciprocal;
+      Reciprocal reciprocal;
       BaseT base;
       Int shift;
       bool can_use_newton;
 
+      struct BlobWriter
+      {
+        vector<uint8_t> bytes;
+
+        template <typename T>
+        void Word(T x)
+        {
+          uint8_t const *p = reinterpret_cast<uint8_t const *>(&x);
+          bytes.insert(bytes.end(), p, p + sizeof(T));
+        }
+
+        template <typename T>
+        void Array(vector<T> const &v)
+        {
+          Word<uint64_t>(v.size());
+          uint8_t const *p = reinterpret_cast<uint8_t const *>(v.data());
+          bytes.insert(bytes.end(), p, p + v.size() * sizeof(T));
+          bytes.resize((bytes.size() + 7) & ~(size_t)7, 0);
+        }
+
+        void Spectrum(NTTMultiplication::PreparedOperand const &p)
+        {
+          Word<uint32_t>(p.operandLimbs);
+          Word<uint32_t>(p.maxOtherLimbs);
+          Word<uint32_t>(p.coeffsPerLimb);
+          Word<int32_t>(p.n);
+          Word<uint64_t>(p.operandCoeffSize);
+          Array(p.f1);
+          Array(p.f2);
+          Array(p.f3);
+        }
+      };
+
+      struct BlobReader
+      {
+        span<const uint8_t> bytes;
+        size_t pos = 0;
+
+        static void Fail()
+        {
+          throw invalid_argument("Malformed divider blob");
+        }
+
+        template <typename T>
+        T Word()
+        {
+          if (bytes.size() - pos < sizeof(T))
+            Fail();
+          T x;
+          std::memcpy(&x, bytes.data() + pos, sizeof(T));
+          pos += sizeof(T);
+          return x;
+        }
+
+        template <typename T>
+        vector<T> Array()
+        {
+          uint64_t count = Word<uint64_t>();
+          if (count > (bytes.size() - pos) / sizeof(T))
+            Fail();
+          vector<T> v(count);
+          std::memcpy(v.data(), bytes.data() + pos, count * sizeof(T));
+          pos = std::min(bytes.size(), (pos + count * sizeof(T) + 7) & ~(size_t)7);
+          return v;
+        }
+
+        NTTMultiplication::PreparedOperand Spectrum(BaseT base)
+        {
+          NTTMultiplication::PreparedOperand p;
+          p.base = base;
+          p.operandLimbs = Word<uint32_t>();
+          p.maxOtherLimbs = Word<uint32_t>();
+          p.coeffsPerLimb = Word<uint32_t>();
+          p.n = Word<int32_t>();
+          p.operandCoeffSize = Word<uint64_t>();
+          p.f1 = Array<UInt>();
+          p.f2 = Array<UInt>();
+          p.f3 = Array<UInt>();
+          if (p.n < 0 || p.f1.size() != (size_t)p.n || p.f2.size() != (size_t)p.n ||
+              p.f3.size() != (size_t)p.n)
+            Fail();
+          return p;
+        }
+      };
+
+      Divider() : base(CurrentBase), shift(0), can_use_newton(false) {}
+
     public:
       Divider(vector<DataT> const &b, BaseT radix) : divisor(b), base(radix), shift(0), can_use_newton(false)
       {
@@ -429,13 +748,14 @@ namespace BigMath
         // Precompute the high-precision reciprocal once. It is valid for both single-block
         // and blockwise division and avoids recomputing the expensive Newton setup for
         // repeated divisions by the same divisor.
-        reciprocal = ApproxReciprocal(b_norm, true);
+        reciprocal = Reciprocal(b_norm, true);
         can_use_newton = true;
       }
 
       pair<vector<DataT>, vector<DataT>> DivideAndRemainder(
           vector<DataT> const &a,
-          bool computeRemainder = true) const
+          bool computeRemainder = true,
+          bool computeQuotient = true) const
       {
         if (IsZero(a))
           return {vector<DataT>{0}, computeRemainder ? vector<DataT>{0} : vector<DataT>()};
@@ -447,7 +767,7 @@ namespace BigMath
           return {vector<DataT>{1}, computeRemainder ? vector<DataT>{0} : vector<DataT>()};
 
         if (!can_use_newton)
-          return FastDivision::DivideAndRemainder(a, divisor, base, computeRemainder);
+          return FastDivision::DivideAndRemainder(a, divisor, base, computeRemainder, computeQuotient);
 
         vector<DataT> a_norm = (shift > 0) ? ShiftLeftBits(a, shift) : a;
         TrimZeros(a_norm);
@@ -460,7 +780,8 @@ namespace BigMath
             a_norm,
             b_norm,
             reciprocal,
-            computeRemainder);
+            computeRemainder,
+            computeQuotient);
       }
 
       void DivideAndRemainderInto(
@@ -479,17 +800,119 @@ namespace BigMath
         return DivideAndRemainder(a, false).first;
       }
 
+      vector<DataT> Remainder(vector<DataT> const &a) const
+      {
+        return DivideAndRemainder(a, true, false).second;
+      }
+
       vector<DataT> const &Divisor() const
       {
         return divisor;
       }
+
+      // The blob described above. The spectra are included only when
+      // includeTransforms is set and the divisor is in the NTT range;
+      // negative is carried for callers that keep a sign.
+      vector<uint8_t> Serialize(bool includeTransforms = false, bool negative = false) const
+      {
+        uint32_t flags = (can_use_newton ? BlobNewton : 0) |
+                         (can_use_newton && includeTransforms && reciprocal.prepared ? BlobTransforms : 0) |
+                         (negative ? BlobNegative : 0);
+        BlobWriter out;
+        out.bytes.insert(out.bytes.end(), BlobMagic, BlobMagic + 4);
+        out.Word<uint32_t>(BlobVersion);
+        out.Word<uint32_t>(LimbBits);
+        out.Word<uint32_t>(flags);
+        out.Word<int64_t>(base);
+        out.Word<int32_t>(shift);
+        out.Word<uint32_t>(NttLayout);
+        out.Array(divisor);
+        if (flags & BlobNewton)
+          out.Array(reciprocal.R);
+        if (flags & BlobTransforms)
+        {
+          out.Spectrum(reciprocal.preparedRLow);
+          out.Spectrum(reciprocal.preparedDivisor);
+        }
+        return std::move(out.bytes);
+      }
+
+      static Divider Deserialize(span<const uint8_t> blob, bool *negative = nullptr)
+      {
+        BlobReader in{blob};
+        if (blob.size() < 4 || std::memcmp(blob.data(), BlobMagic, 4) != 0)
+          BlobReader::Fail();
+        in.pos = 4;
+        if (in.Word<uint32_t>() != BlobVersion)
+          throw invalid_argument("Unsupported divider blob version");
+        if (in.Word<uint32_t>() != LimbBits)
+          throw invalid_argument("Divider blob limb width does not match this build");
+        uint32_t flags = in.Word<uint32_t>();
+
+        Divider d;
+        d.base = (BaseT)in.Word<int64_t>();
+        d.shift = in.Word<int32_t>();
+        uint32_t layout = in.Word<uint32_t>();
+        d.divisor = in.Array<DataT>();
+        if (d.divisor.empty() || d.divisor.back() == 0 ||
+            std::any_of(d.divisor.begin(), d.divisor.end(), [](DataT x) { return x > LimbMask; }))
+          BlobReader::Fail();
+        if (negative)
+          *negative = (flags & BlobNegative) != 0;
+
+        bool binary = d.base == Base2_32 || d.base == Base2_64;
+        if (!(flags & BlobNewton))
+        {
+          if (binary && d.divisor.size() > 1)
+            BlobReader::Fail();
+          d.shift = 0;
+          return d;
+        }
+        if (!binary || d.base != CurrentBase || d.divisor.size() <= 1 ||
+            d.shift != std::countl_zero(d.divisor.back()) - (Int)(64 - LimbBits))
+          BlobReader::Fail();
+
+        d.b_norm = d.shift > 0 ? ShiftLeftBits(d.divisor, d.shift) : d.divisor;
+        TrimZeros(d.b_norm);
+        vector<DataT> R = in.Array<DataT>();
+        if (R.empty())
+          BlobReader::Fail();
+        d.reciprocal = Reciprocal(std::move(R), d.b_norm, false);
+        if (d.reciprocal.prepared)
+        {
+          if ((flags & BlobTransforms) && layout == NttLayout)
+          {
+            d.reciprocal.preparedRLow = in.Spectrum(d.base);
+            d.reciprocal.preparedDivisor = in.Spectrum(d.base);
+            auto const &pr = d.reciprocal.preparedRLow, &pd = d.reciprocal.preparedDivisor;
+            ULong cpl = NttCrt::CoeffsPerLimb(d.base);
+            if (pr.coeffsPerLimb != cpl || pd.coeffsPerLimb != cpl ||
+                pr.operandLimbs != d.reciprocal.RLow.size() || pr.maxOtherLimbs != d.b_norm.size() ||
+                pd.operandLimbs != d.b_norm.size() || pd.maxOtherLimbs != d.reciprocal.K ||
+                (!pr.Empty() && (pr.operandCoeffSize != pr.operandLimbs * cpl ||
+                                 (ULong)pr.n != std::max<ULong>(2, std::bit_ceil(pr.operandCoeffSize + pr.maxOtherLimbs * cpl - 1)))) ||
+                pd.operandCoeffSize != pd.operandLimbs * cpl || (ULong)pd.n != d.reciprocal.K * cpl)
+              BlobReader::Fail();
+          }
+          else
+          {
+            SizeT n = (SizeT)d.b_norm.size();
+            d.reciprocal.preparedRLow = NTTMultiplication::PrepareOperand(d.reciprocal.RLow, n, CurrentBase);
+            d.reciprocal.preparedDivisor = NTTMultiplication::PrepareWrap(d.b_norm, d.reciprocal.K, CurrentBase);
+          }
+        }
+        d.can_use_newton = true;
+        return d;
+      }
     };
 
     static pair<vector<DataT>, vector<DataT>> DivideAndRemainder(
         vector<DataT> const &a,
         vector<DataT> const &b,
         BaseT base,
-        bool computeRemainder = true)
+        bool computeRemainder = true,
+        bool computeQuotient = true,
+        SizeT workers = 1)
     {
       if (IsZero(b))
         throw invalid_argument("Division by zero");
@@ -505,7 +928,7 @@ namespace BigMath
       // Newton supports Base2_32 and Base2_64 multi-limb divisors. Other bases
       // and single-limb divisors fall back to FastDivision.
       if ((base != Base2_32 && base != Base2_64) || b.size() <= 1)
-        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
+        return FastDivision::DivideAndRemainder(a, b, base, computeRemainder, computeQuotient);
 
       // Normalize: shift so top bit of b's top limb is set.
       DataT b_top = b.back();
@@ -535,14 +958,19 @@ namespace BigMath
       // can't catch up. The extra refinement iter at full precision drops Q error to ≤ 1.
       bool need_high_precision = (na >= 2 * n);
 
-      vector<DataT> R = ApproxReciprocal(b_norm, need_high_precision);
-      return DivideNormalizedWithReciprocal(a, b, base, shift, a_norm, b_norm, R, computeRemainder);
+      Reciprocal R(b_norm, need_high_precision);
+      return DivideNormalizedWithReciprocal(a, b, base, shift, a_norm, b_norm, R, computeRemainder, computeQuotient, workers);
     }
 
     static vector<DataT> Divide(vector<DataT> const &a, vector<DataT> const &b, BaseT base)
     {
       return DivideAndRemainder(a, b, base, false).first;
     }
+
+    static vector<DataT> Remainder(vector<DataT> const &a, vector<DataT> const &b, BaseT base)
+    {
+      return DivideAndRemainder(a, b, base, true, false).second;
+    }
   };
 }
 
@@ -1,6 +1,8 @@
 #ifndef RECIPROCAL_DIVISION
 #define RECIPROCAL_DIVISION
 
+#include <cstdint>
+#include <span>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -18,6 +20,8 @@ namespace BigMath
     private:
       NewtonDivision::Divider divider;
 
+      explicit Divider(NewtonDivision::Divider d) : divider(std::move(d)) {}
+
     public:
       Divider(vector<DataT> const &b, BaseT radix) : divider(b, radix) {}
 
@@ -33,10 +37,26 @@ namespace BigMath
         return divider.Divide(a);
       }
 
+      vector<DataT> Remainder(vector<DataT> const &a) const
+      {
+        return divider.Remainder(a);
+      }
+
       vector<DataT> const &Divisor() const
       {
         return divider.Divisor();
       }
+
+      // See NewtonDivision::Divider::Serialize.
+      vector<uint8_t> Serialize(bool includeTransforms = false, bool negative = false) const
+      {
+        return divider.Serialize(includeTransforms, negative);
+      }
+
+      static Divider Deserialize(span<const uint8_t> blob, bool *negative = nullptr)
+      {
+        return Divider(NewtonDivision::Divider::Deserialize(blob, negative));
+      }
     };
 
     static pair<vector<DataT>, vector<DataT>> DivideAndRemainder(
@@ -54,6 +74,14 @@ namespace BigMath
     {
       return Divider(b, base).Divide(a);
     }
+
+    static vector<DataT> Remainder(
+        vector<DataT> const &a,
+        vector<DataT> const &b,
+        BaseT base)
+    {
+      return Divider(b, base).Remainder(a);
+    }
   };
 }
 
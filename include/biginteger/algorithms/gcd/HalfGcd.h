@@ -0,0 +1,167 @@
+/**
+ * BigMath: Subquadratic GCD by half-GCD (Schönhage / Möller).
+ *
+ * Reduce(a, b, s) advances the Euclidean remainder sequence of a ≥ b while
+ * keeping b ≥ 2^s, returning the matrix M with (a_in; b_in) = M·(a; b).
+ * When a is large it recurses on the top bits first:
+ *
+ *   p    = max(n/2, 2s + 2 − n − 2·MARGIN)      bits dropped
+ *   s_hi = ⌈(n − p)/2⌉ + MARGIN                 stop bound for the top part
+ *
+ * The top part is reduced only halfway (+ MARGIN bits), where the
+ * quotient sequences of the truncated and full pairs still agree, so
+ * applying M_hi⁻¹ to the full (a, b) lands at ≥ s + 1 bits. Two recursive
+ * calls per level on half-size inputs plus a constant number of full-size
+ * products give O(M(n)·log n). Lehmer rounds and exact division steps
+ * bridge the gaps and take over below HGCD_THRESHOLD bits.
+ *
+ * Every matrix is unimodular with non-negative entries, so an application
+ * that would go negative (a truncation the margin did not cover) is simply
+ * rejected and the loop continues with a Lehmer round: the GCD and the
+ * cofactor identity hold regardless; only speed depends on the margin.
+ *
+ * Gcd() halves a with Reduce(a, b, n/2) plus one division step per pass
+ * until Lehmer's range. ExtendedGcd() tracks the product of all matrices:
+ * with (a₀; b₀) = M·(g; 0), g = det·(m₁₁·a₀ − m₀₁·b₀).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef HALF_GCD
+#define HALF_GCD
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+using namespace std;
+
+#include "../../common/Comparator.h"
+#include "../../common/Util.h"
+#include "../Subtraction.h"
+#include "LehmerGcd.h"
+
+#ifndef BIGMATH_HGCD_THRESHOLD
+// Bits of a at which Reduce recurses instead of running Lehmer rounds.
+#define BIGMATH_HGCD_THRESHOLD 8192
+#endif
+
+#ifndef BIGMATH_GCD_HGCD_THRESHOLD
+// Limbs of a at which Gcd/ExtendedGcd switch from Lehmer to half-GCD.
+#define BIGMATH_GCD_HGCD_THRESHOLD 320
+#endif
+
+namespace BigMath
+{
+  class HalfGcd
+  {
+  public:
+    using Matrix = LehmerGcd::Matrix;
+
+    static const SizeT HGCD_THRESHOLD = BIGMATH_HGCD_THRESHOLD;
+    static const SizeT GCD_HGCD_THRESHOLD = BIGMATH_GCD_HGCD_THRESHOLD;
+    static const SizeT MARGIN = 64;
+
+  private:
+    // (a, b) ← M⁻¹·(a, b) = det·(m₁₁a − m₀₁b, m₀₀b − m₁₀a). Rejected (inputs
+    // untouched) unless the result keeps a ≥ b ≥ 2^s.
+    static bool ApplyInverse(Matrix const &M, vector<DataT> &a, vector<DataT> &b, SizeT s)
+    {
+      vector<DataT> x1 = LehmerGcd::Product(M.m[1][1], a);
+      vector<DataT> y1 = LehmerGcd::Product(M.m[0][1], b);
+      vector<DataT> x2 = LehmerGcd::Product(M.m[0][0], b);
+      vector<DataT> y2 = LehmerGcd::Product(M.m[1][0], a);
+      if (M.det < 0)
+      {
+        std::swap(x1, y1);
+        std::swap(x2, y2);
+      }
+      if (Compare(x1, y1) < 0 || Compare(x2, y2) < 0)
+        return false;
+      vector<DataT> na = Subtract(x1, y1, CurrentBase);
+      vector<DataT> nb = Subtract(x2, y2, CurrentBase);
+      TrimZerosToOne(na);
+      TrimZerosToOne(nb);
+      if (BitLength(nb) <= s || Compare(na, nb) < 0)
+        return false;
+      a = std::move(na);
+      b = std::move(nb);
+      return true;
+    }
+
+  public:
+    // Advance a ≥ b ≥ 2^s while b stays ≥ 2^s. M accumulates the steps
+    // when non-null.
+    static void Reduce(vector<DataT> &a, vector<DataT> &b, SizeT s, Matrix *M)
+    {
+      while (BitLength(b) > s)
+      {
+        SizeT n = BitLength(a);
+        if (n >= HGCD_THRESHOLD)
+        {
+          Long want = 2 * (Long)s + 2 - (Long)n - 2 * (Long)MARGIN;
+          SizeT p = (SizeT)std::max((Long)(n / 2), want);
+          SizeT h = n - p;
+          SizeT sHi = (h + 1) / 2 + MARGIN;
+          vector<DataT> aHi = ShiftRightBits(a, p);
+          vector<DataT> bHi = ShiftRightBits(b, p);
+          if (BitLength(bHi) > sHi)
+          {
+            Matrix Mh;
+            Reduce(aHi, bHi, sHi, &Mh);
+            if (!Mh.IsIdentity() && ApplyInverse(Mh, a, b, s))
+            {
+              if (M)
+                LehmerGcd::MultiplyMatrix(*M, Mh);
+              continue;
+            }
+          }
+        }
+        if (LehmerGcd::Round(a, b, s, M))
+          continue;
+        if (!LehmerGcd::DivisionStep(a, b, s, M))
+          break;
+      }
+    }
+
+    // GCD of a ≥ b.
+    static vector<DataT> Gcd(vector<DataT> a, vector<DataT> b)
+    {
+      TrimZerosToOne(a);
+      TrimZerosToOne(b);
+      while (a.size() >= GCD_HGCD_THRESHOLD && !IsZero(b))
+      {
+        Reduce(a, b, BitLength(a) / 2, nullptr);
+        LehmerGcd::DivisionStep(a, b, 0, nullptr);
+      }
+      if (IsZero(b))
+        return a;
+      return LehmerGcd::Gcd(std::move(a), std::move(b));
+    }
+
+    // g = gcd(a, b) for a ≥ b, with g = s·a + t·b. Cofactors come back as
+    // magnitudes; sNegative tells which one carries the minus sign (they
+    // always have opposite signs or one is zero).
+    static vector<DataT> ExtendedGcd(vector<DataT> a, vector<DataT> b,
+                                     vector<DataT> &s, vector<DataT> &t,
+                                     bool &sNegative)
+    {
+      TrimZerosToOne(a);
+      TrimZerosToOne(b);
+      Matrix M;
+      while (a.size() >= GCD_HGCD_THRESHOLD && !IsZero(b))
+      {
+        Reduce(a, b, BitLength(a) / 2, &M);
+        LehmerGcd::DivisionStep(a, b, 0, &M);
+      }
+      LehmerGcd::Reduce(a, b, M);
+
+      // g = det·(m₁₁·a₀ − m₀₁·b₀)
+      s = M.m[1][1];
+      t = M.m[0][1];
+      sNegative = M.det < 0;
+      return a;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,321 @@
+/**
+ * BigMath: Lehmer GCD and the limb helpers shared with HalfGcd.
+ *
+ * A Lehmer round runs Euclid on the top 63 bits of (a, b) with signed
+ * single-word cofactors (Cohen, Alg. 1.3.7 / Knuth Alg. L: a quotient is
+ * taken only while both bracketing estimates agree), then applies the
+ * accumulated 2×2 matrix to the full numbers in one O(n) pass. A step is
+ * kept only while the reduced top word still exceeds |C| + |D| (the
+ * truncation error bound). Every cofactor then stays below that word, and
+ * so below 2^63, which is what the single-word products in MulSub need.
+ * On random operands a round ends with cofactors of about 29 bits (21 to
+ * 32 measured) and strips about as many bits, so a full GCD is O(n²) word
+ * operations with a small constant. A round that cannot agree on a single
+ * quotient falls back to one exact division step.
+ *
+ * Single-limb tails finish with binary GCD.
+ *
+ * Matrices track (a_in; b_in) = M · (a; b): entries are non-negative and
+ * det M = ±1, so applying M⁻¹ never changes the GCD. HalfGcd reuses the
+ * same matrix and round with a stop bound s (never reduce b below 2^s).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef LEHMER_GCD
+#define LEHMER_GCD
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+using namespace std;
+
+#include "../../common/Comparator.h"
+#include "../../common/Util.h"
+#include "../Addition.h"
+#include "../Division.h"
+#include "../Multiplication.h"
+#include "../Shift.h"
+
+namespace BigMath
+{
+  class LehmerGcd
+  {
+  public:
+    // (a_in; b_in) = M · (a; b), non-negative entries, det = ±1.
+    struct Matrix
+    {
+      vector<DataT> m[2][2];
+      int det;
+
+      Matrix() : det(1)
+      {
+        m[0][0] = vector<DataT>{1};
+        m[0][1] = vector<DataT>{0};
+        m[1][0] = vector<DataT>{0};
+        m[1][1] = vector<DataT>{1};
+      }
+
+      bool IsIdentity() const
+      {
+        return det == 1 && IsZero(m[0][1]) && IsZero(m[1][0]);
+      }
+    };
+
+    // Signed single-word cofactors of one Lehmer round:
+    // (a'; b') = [[A, B], [C, D]] · (a; b).
+    struct Cofactors
+    {
+      Long A, B, C, D;
+    };
+
+    // Bits [shift, shift + 63) of v.
+    static ULong TopBits(vector<DataT> const &v, SizeT shift)
+    {
+      SizeT limb = shift / LimbBits;
+      SizeT off = shift % LimbBits;
+      ULong128 acc = 0;
+      for (SizeT j = 0; j < 3 && j * LimbBits < 128; ++j)
+        if (limb + j < v.size())
+          acc |= (ULong128)v[limb + j] << (j * LimbBits);
+      return (ULong)(acc >> off) & 0x7FFFFFFFFFFFFFFFULL;
+    }
+
+    // Trailing zeros of a non-empty r, down to one limb. Unlike
+    // TrimZerosToOne it never empties r and pushes back, which GCC flags
+    // with -Wfree-nonheap-object once MulSub is inlined into Round.
+    static void TrimToOne(vector<DataT> &r)
+    {
+      while (r.size() > 1 && r.back() == 0)
+        r.pop_back();
+    }
+
+    // x·u − y·v for x, y < 2^63. Returns false (out untouched) if negative.
+    static bool MulSub(vector<DataT> const &u, ULong x,
+                       vector<DataT> const &v, ULong y,
+                       vector<DataT> &out)
+    {
+      SizeT len = (SizeT)std::max(u.size(), v.size()) + 2;
+      vector<DataT> r(len, 0);
+      Long128 carry = 0;
+      for (SizeT i = 0; i < len; ++i)
+      {
+        Long128 t = carry;
+        if (i < u.size())
+          t += (Long128)((ULong128)x * u[i]);
+        if (i < v.size())
+          t -= (Long128)((ULong128)y * v[i]);
+        r[i] = (DataT)((ULong128)t & LimbMask);
+        carry = t >> LimbBits;
+      }
+      if (carry < 0)
+        return false;
+      TrimToOne(r);
+      out = std::move(r);
+      return true;
+    }
+
+    // x·u + y·v for x, y < 2^63.
+    static vector<DataT> MulAdd(vector<DataT> const &u, ULong x,
+                                vector<DataT> const &v, ULong y)
+    {
+      SizeT len = (SizeT)std::max(u.size(), v.size()) + 2;
+      vector<DataT> r(len, 0);
+      ULong128 carry = 0;
+      for (SizeT i = 0; i < len; ++i)
+      {
+        ULong128 t = carry;
+        if (i < u.size())
+          t += (ULong128)x * u[i];
+        if (i < v.size())
+          t += (ULong128)y * v[i];
+        r[i] = (DataT)(t & LimbMask);
+        carry = t >> LimbBits;
+      }
+      TrimToOne(r);
+      return r;
+    }
+
+    static vector<DataT> Product(vector<DataT> const &u, vector<DataT> const &v)
+    {
+      if (IsZero(u) || IsZero(v))
+        return vector<DataT>{0};
+      vector<DataT> p = Multiply(u, v, CurrentBase);
+      TrimZerosToOne(p);
+      return p;
+    }
+
+    static vector<DataT> Sum(vector<DataT> const &u, vector<DataT> const &v)
+    {
+      vector<DataT> r = Add(u, v, CurrentBase);
+      TrimZerosToOne(r);
+      return r;
+    }
+
+    // M ← M · N.
+    static void MultiplyMatrix(Matrix &M, Matrix const &N)
+    {
+      vector<DataT> r[2][2];
+      for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 2; ++j)
+          r[i][j] = Sum(Product(M.m[i][0], N.m[0][j]), Product(M.m[i][1], N.m[1][j]));
+      for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 2; ++j)
+          M.m[i][j] = std::move(r[i][j]);
+      M.det *= N.det;
+    }
+
+    // M ← M · [[D, −B], [−C, A]]·det: the inverse of one round's cofactors.
+    static void MultiplyMatrix(Matrix &M, Cofactors const &c)
+    {
+      ULong s00 = (ULong)(c.D < 0 ? -c.D : c.D);
+      ULong s01 = (ULong)(c.B < 0 ? -c.B : c.B);
+      ULong s10 = (ULong)(c.C < 0 ? -c.C : c.C);
+      ULong s11 = (ULong)(c.A < 0 ? -c.A : c.A);
+      for (int i = 0; i < 2; ++i)
+      {
+        vector<DataT> r0 = MulAdd(M.m[i][0], s00, M.m[i][1], s10);
+        vector<DataT> r1 = MulAdd(M.m[i][0], s01, M.m[i][1], s11);
+        M.m[i][0] = std::move(r0);
+        M.m[i][1] = std::move(r1);
+      }
+      M.det *= (Long128)c.A * c.D - (Long128)c.B * c.C > 0 ? 1 : -1;
+    }
+
+    // M ← M · [[q, 1], [1, 0]]: one exact division step a = q·b + r.
+    static void MultiplyMatrix(Matrix &M, vector<DataT> const &q)
+    {
+      for (int i = 0; i < 2; ++i)
+      {
+        vector<DataT> r0 = Sum(Product(M.m[i][0], q), M.m[i][1]);
+        M.m[i][1] = std::move(M.m[i][0]);
+        M.m[i][0] = std::move(r0);
+      }
+      M.det = -M.det;
+    }
+
+    // One Lehmer round on a ≥ b > 0. Accepted steps keep b ≥ 2^s (exactly,
+    // using the truncation error bound |C|+|D| in units of 2^shift).
+    // Returns false when no quotient could be certified.
+    static bool Round(vector<DataT> &a, vector<DataT> &b, SizeT s, Matrix *M)
+    {
+      SizeT n = BitLength(a);
+      SizeT shift = n > 63 ? n - 63 : 0;
+      if (s >= shift + 62)
+        return false;
+      Long128 bound = (Long128)1 << (s > shift ? s - shift : 0);
+
+      Long128 ah = TopBits(a, shift);
+      Long128 bh = TopBits(b, shift);
+      Long A = 1, B = 0, C = 0, D = 1;
+      while (true)
+      {
+        if (bh + C <= 0 || bh + D <= 0)
+          break;
+        Long128 q = (ah + A) / (bh + C);
+        if (q != (ah + B) / (bh + D))
+          break;
+        Long128 nC = A - q * C;
+        Long128 nD = B - q * D;
+        Long128 nb = ah - q * bh;
+        Long128 err = (nC < 0 ? -nC : nC) + (nD < 0 ? -nD : nD);
+        if (nb - err < bound)
+          break;
+        A = C;
+        B = D;
+        C = (Long)nC;
+        D = (Long)nD;
+        ah = bh;
+        bh = nb;
+      }
+      if (B == 0)
+        return false;
+
+      // Each row has entries of opposite sign or one zero; branch on the
+      // second entry so a zero first entry (A = 0 after one step) never
+      // turns into a negated multiplier.
+      Cofactors c{A, B, C, D};
+      vector<DataT> na, nb;
+      bool ok = (B <= 0 ? MulSub(a, (ULong)A, b, (ULong)-B, na)
+                        : MulSub(b, (ULong)B, a, (ULong)-A, na)) &&
+                (D <= 0 ? MulSub(a, (ULong)C, b, (ULong)-D, nb)
+                        : MulSub(b, (ULong)D, a, (ULong)-C, nb));
+      if (!ok)
+        return false;
+      a = std::move(na);
+      b = std::move(nb);
+      if (M)
+        MultiplyMatrix(*M, c);
+      return true;
+    }
+
+    // One exact step (a, b) ← (b, a mod b). With s > 0 the step is skipped
+    // (returns false) if the remainder would drop below 2^s.
+    static bool DivisionStep(vector<DataT> &a, vector<DataT> &b, SizeT s, Matrix *M)
+    {
+      auto [q, r] = DivideAndRemainder(a, b, CurrentBase);
+      TrimZerosToOne(r);
+      if (s > 0 && BitLength(r) <= s)
+        return false;
+      TrimZerosToOne(q);
+      if (M)
+        MultiplyMatrix(*M, q);
+      a = std::move(b);
+      b = std::move(r);
+      return true;
+    }
+
+    static ULong BinaryGcd(ULong u, ULong v)
+    {
+      if (u == 0)
+        return v;
+      if (v == 0)
+        return u;
+      int k = __builtin_ctzll(u | v);
+      u >>= __builtin_ctzll(u);
+      while (v != 0)
+      {
+        v >>= __builtin_ctzll(v);
+        if (u > v)
+          std::swap(u, v);
+        v -= u;
+      }
+      return u << k;
+    }
+
+    // a mod d for a single-limb d.
+    static ULong ModLimb(vector<DataT> const &a, ULong d)
+    {
+      return ClassicDivision::Mod(a, (DataT)d, CurrentBase);
+    }
+
+    // GCD of a ≥ b; both consumed. Rounds until b fits a limb.
+    static vector<DataT> Gcd(vector<DataT> a, vector<DataT> b)
+    {
+      TrimZerosToOne(a);
+      TrimZerosToOne(b);
+      while (b.size() > 1)
+      {
+        if (!Round(a, b, 0, nullptr))
+          DivisionStep(a, b, 0, nullptr);
+      }
+      if (b[0] == 0)
+        return a;
+      return vector<DataT>{(DataT)BinaryGcd(b[0], ModLimb(a, b[0]))};
+    }
+
+    // Runs a ≥ b down to b = 0 tracking the matrix: a ends as the GCD.
+    static void Reduce(vector<DataT> &a, vector<DataT> &b, Matrix &M)
+    {
+      TrimZerosToOne(a);
+      TrimZerosToOne(b);
+      while (!IsZero(b))
+      {
+        if (!Round(a, b, 0, &M))
+          DivisionStep(a, b, 0, &M);
+      }
+    }
+  };
+}
+
+#endif
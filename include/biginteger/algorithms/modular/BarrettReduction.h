@@ -0,0 +1,227 @@
+/**
+ * BigMath: Barrett reduction by a fixed modulus.
+ *
+ * For a k-limb modulus m keeps μ = ⌊B^2k / m⌋ (computed once through the
+ * cached Newton reciprocal of ReciprocalDivision::Divider) and reduces any
+ * x < B^2k (in particular x < m²) with (HAC 14.42):
+ *
+ *   q̂ = ⌊⌊x / B^(k−1)⌋ · μ / B^(k+1)⌋       q − 2 ≤ q̂ ≤ q
+ *   r = (x − q̂·m) mod B^(k+1), then r −= m at most twice
+ *
+ * Only the top half of the first product and the low k+1 limbs of the
+ * second are read; inside the schoolbook band the second is a truncated
+ * (low short) product. No quotient is materialized.
+ *
+ * Products run through KaratsubaMultiplication::MultiplyInto (Comba /
+ * schoolbook leaves included) on scratch sized at construction. From
+ * NTT_MULTIPLICATION_THRESHOLD they take prepared CRT NTT spectra of μ and
+ * m instead, reading x in place and landing in a reused product buffer.
+ * Either way a Reduce call does not allocate once the output vector and
+ * the thread's transform buffers have capacity.
+ *
+ * The scratch makes Reduce non-const: one Reducer per thread.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BARRETT_REDUCTION
+#define BARRETT_REDUCTION
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+using namespace std;
+
+#include "../../common/Util.h"
+#include "../Multiplication.h"
+#include "../division/ReciprocalDivision.h"
+#include "../multiplication/KaratsubaMultiplication.h"
+#include "../multiplication/NTTMultiplication.h"
+
+namespace BigMath
+{
+  class BarrettReduction
+  {
+  public:
+    class Reducer
+    {
+    private:
+      ReciprocalDivision::Divider divider;
+      vector<DataT> modulus;
+      vector<DataT> mu;
+      NTTMultiplication::PreparedOperand preparedMu;
+      NTTMultiplication::PreparedOperand preparedModulus;
+      vector<DataT> q2;       // q1 · μ            (2k+2 limbs)
+      vector<DataT> q3m;      // q̂ · m             (2k+1 limbs)
+      vector<DataT> work;     // Karatsuba workspace
+      vector<DataT> product;  // prepared NTT product
+      SizeT k;
+      bool prepared;
+
+      // out[0..la+lb-1] = a · b.
+      void MultiplyInto(const DataT *a, SizeT la, const DataT *b, SizeT lb,
+                        NTTMultiplication::PreparedOperand const &pb, DataT *out)
+      {
+        if (prepared)
+        {
+          NTTMultiplication::MultiplyInto(pb, a, la, product);
+          std::memset(out, 0, (la + lb) * sizeof(DataT));
+          std::memcpy(out, product.data(), std::min((SizeT)product.size(), la + lb) * sizeof(DataT));
+          return;
+        }
+        KaratsubaMultiplication::MultiplyInto(a, la, b, lb, out, work.data(), CurrentBase);
+      }
+
+      // out[0..len-1] = (a · b) mod B^len, schoolbook over the columns < len
+      // only: half the multiplies of the full product.
+      static void LowMultiplyInto(const DataT *a, SizeT la, const DataT *b, SizeT lb,
+                                  DataT *out, SizeT len)
+      {
+        std::memset(out, 0, len * sizeof(DataT));
+        for (SizeT i = 0; i < lb && i < len; ++i)
+        {
+          ULong bi = b[i];
+          if (bi == 0)
+            continue;
+          ULong carry = 0;
+          SizeT jEnd = std::min(la, len - i);
+          for (SizeT j = 0; j < jEnd; ++j)
+          {
+            ULong128 p = (ULong128)a[j] * bi + out[i + j] + carry;
+            out[i + j] = (DataT)(p & LimbMask);
+            carry = (ULong)(p >> LimbBits);
+          }
+          if (i + jEnd < len)
+            out[i + jEnd] = (DataT)carry;
+        }
+      }
+
+      static SizeT Significant(const DataT *v, SizeT len)
+      {
+        while (len > 0 && v[len - 1] == 0)
+          --len;
+        return len;
+      }
+
+      // r (k+1 limbs, top may be zero) ≥ m ?
+      bool AtLeastModulus(vector<DataT> const &r) const
+      {
+        if (r[k] != 0)
+          return true;
+        for (SizeT i = k; i-- > 0;)
+          if (r[i] != modulus[i])
+            return r[i] > modulus[i];
+        return true;
+      }
+
+      void SubtractModulus(vector<DataT> &r) const
+      {
+        ULong borrow = 0;
+        for (SizeT i = 0; i <= k; ++i)
+        {
+          ULong128 t = (ULong128)r[i] - (i < k ? modulus[i] : 0) - borrow;
+          r[i] = (DataT)(t & LimbMask);
+          borrow = (ULong)(t >> 127);
+        }
+      }
+
+    public:
+      explicit Reducer(vector<DataT> const &m)
+          : divider(m, CurrentBase), modulus(m), k(0), prepared(false)
+      {
+        TrimZeros(modulus);
+        k = (SizeT)modulus.size();
+
+        vector<DataT> b2k(2 * k + 1, 0);
+        b2k[2 * k] = 1;
+        mu = divider.Divide(b2k);
+        TrimZeros(mu);
+
+        q2.assign(2 * k + 2, 0);
+        q3m.assign(2 * k + 1, 0);
+        prepared = 2 * (k + 1) >= NTT_MULTIPLICATION_THRESHOLD &&
+                   (CurrentBase == Base2_32 || CurrentBase == Base2_64);
+        if (prepared)
+        {
+          preparedMu = NTTMultiplication::PrepareOperand(mu, k + 1, CurrentBase);
+          preparedModulus = NTTMultiplication::PrepareOperand(modulus, k + 1, CurrentBase);
+          product.reserve(2 * k + 4);
+        }
+        else
+          work.assign(KaratsubaMultiplication::WorkspaceLimbs(k + 1), 0);
+      }
+
+      // r = x mod m. Barrett for x < B^2k, the cached divider otherwise.
+      // r must not alias x; its capacity is reused across calls.
+      void Reduce(vector<DataT> const &x, vector<DataT> &r)
+      {
+        SizeT xs = Significant(x.data(), (SizeT)x.size());
+        if (xs < k || (xs == k && Compare(x, modulus) < 0))
+        {
+          r.assign(x.begin(), x.begin() + std::max(xs, (SizeT)1));
+          if (xs == 0)
+            r[0] = 0;
+          return;
+        }
+        if (xs > 2 * k)
+        {
+          r = divider.Remainder(x);
+          TrimZerosToOne(r);
+          return;
+        }
+
+        // q̂ = ⌊q1 · μ / B^(k+1)⌋ with q1 = ⌊x / B^(k−1)⌋.
+        const DataT *q1 = x.data() + (k - 1);
+        SizeT l1 = xs - (k - 1);
+        SizeT lmu = (SizeT)mu.size();
+        MultiplyInto(q1, l1, mu.data(), lmu, preparedMu, q2.data());
+        SizeT l2 = l1 + lmu;
+        SizeT l3 = l2 > k + 1 ? Significant(q2.data() + (k + 1), l2 - (k + 1)) : 0;
+
+        // r = (x − q̂·m) mod B^(k+1).
+        r.resize(k + 1);
+        if (l3 == 0)
+        {
+          for (SizeT i = 0; i <= k; ++i)
+            r[i] = i < xs ? x[i] : 0;
+        }
+        else
+        {
+          SizeT lp = k + 1;
+          if (prepared || lp > BIGMATH_KARATSUBA_THRESHOLD)
+          {
+            MultiplyInto(q2.data() + (k + 1), l3, modulus.data(), k, preparedModulus, q3m.data());
+            lp = l3 + k;
+          }
+          else
+            LowMultiplyInto(q2.data() + (k + 1), l3, modulus.data(), k, q3m.data(), lp);
+          ULong borrow = 0;
+          for (SizeT i = 0; i <= k; ++i)
+          {
+            ULong128 t = (ULong128)(i < xs ? x[i] : 0) - (i < lp ? q3m[i] : 0) - borrow;
+            r[i] = (DataT)(t & LimbMask);
+            borrow = (ULong)(t >> 127);
+          }
+        }
+
+        while (AtLeastModulus(r))
+          SubtractModulus(r);
+        TrimZerosToOne(r);
+      }
+
+      vector<DataT> Reduce(vector<DataT> const &x)
+      {
+        vector<DataT> r;
+        Reduce(x, r);
+        return r;
+      }
+
+      vector<DataT> const &Modulus() const
+      {
+        return modulus;
+      }
+    };
+  };
+}
+
+#endif
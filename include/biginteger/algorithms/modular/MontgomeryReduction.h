@@ -0,0 +1,340 @@
+/**
+ * BigMath: Montgomery modular multiplication for a fixed odd modulus.
+ *
+ * For an n-limb odd modulus m and R = B^n, values are kept in Montgomery
+ * form x̃ = x·R mod m. A product of two forms is brought back with
+ * REDC(T) = T·R⁻¹ mod m, so a modular multiply is one ordinary multiply
+ * (through the Multiply/Square dispatchers) plus one REDC.
+ *
+ * REDC has two shapes:
+ *   n < MONTGOMERY_BLOCK_THRESHOLD   word-by-word (m' = −m⁻¹ mod B),
+ *                                    n² limb multiplies, no allocation
+ *                                    beyond the working copy of T
+ *   otherwise                        block form with M = −m⁻¹ mod R:
+ *                                    q = (T mod R)·M mod R, (T + q·m) / R,
+ *                                    two dispatcher products
+ *
+ * From MONTGOMERY_PREPARED_THRESHOLD limbs the block products take the
+ * prepared CRT NTT spectra of m and M (see NTTMultiplication::PrepareOperand),
+ * saving one forward transform set per product.
+ *
+ * Pow uses left-to-right sliding-window exponentiation over odd powers,
+ * window width picked from the exponent bit length.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef MONTGOMERY_REDUCTION
+#define MONTGOMERY_REDUCTION
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+#include "../../common/Comparator.h"
+#include "../../common/Util.h"
+#include "../Division.h"
+#include "../Multiplication.h"
+#include "../Shift.h"
+#include "../Squaring.h"
+#include "../Subtraction.h"
+#include "../division/HenselDivision.h"
+#include "../multiplication/NTTMultiplication.h"
+
+#ifndef BIGMATH_MONTGOMERY_BLOCK_THRESHOLD
+#define BIGMATH_MONTGOMERY_BLOCK_THRESHOLD 512
+#endif
+
+#ifndef BIGMATH_MONTGOMERY_PREPARED_THRESHOLD
+#define BIGMATH_MONTGOMERY_PREPARED_THRESHOLD (BIGMATH_NTT_MULTIPLICATION_THRESHOLD / 2)
+#endif
+
+namespace BigMath
+{
+  class MontgomeryReduction
+  {
+  public:
+    static const SizeT MONTGOMERY_BLOCK_THRESHOLD = BIGMATH_MONTGOMERY_BLOCK_THRESHOLD;
+    static const SizeT MONTGOMERY_PREPARED_THRESHOLD = BIGMATH_MONTGOMERY_PREPARED_THRESHOLD;
+
+    static DataT InverseLimb(DataT m0)
+    {
+      return HenselDivision::InverseLimb(m0);
+    }
+
+    // Low k limbs of a·b, zero-padded to exactly k limbs.
+    static vector<DataT> LowProduct(vector<DataT> const &a, vector<DataT> const &b, SizeT k)
+    {
+      vector<DataT> ak(a.begin(), a.begin() + std::min((SizeT)a.size(), k));
+      vector<DataT> bk(b.begin(), b.begin() + std::min((SizeT)b.size(), k));
+      TrimZeros(ak);
+      TrimZeros(bk);
+      if (ak.empty() || bk.empty())
+        return vector<DataT>(k, 0);
+      vector<DataT> p = Multiply(ak, bk, CurrentBase);
+      p.resize(k, 0);
+      return p;
+    }
+
+    // B^k − x mod B^k, in place on a k-limb vector (two's complement per limb).
+    static void NegateModPower(vector<DataT> &x)
+    {
+      ULong carry = 1;
+      for (SizeT i = 0; i < x.size(); ++i)
+      {
+        ULong v = ((~(ULong)x[i]) & LimbMask) + carry;
+        x[i] = (DataT)(v & LimbMask);
+        carry = (LimbBits == 64) ? (ULong)(v == 0 && carry) : (v >> LimbBits);
+      }
+    }
+
+    // m⁻¹ mod B^n for odd m (n limbs).
+    static vector<DataT> InverseModPower(vector<DataT> const &m, SizeT n)
+    {
+      return HenselDivision::Inverse(m, n);
+    }
+
+    class Context
+    {
+    private:
+      vector<DataT> modulus;
+      vector<DataT> negInverse;   // −m⁻¹ mod R (block REDC only)
+      vector<DataT> rModM;        // R mod m   (Montgomery form of 1)
+      vector<DataT> r2ModM;       // R² mod m  (ToMontgomery multiplier)
+      NTTMultiplication::PreparedOperand preparedModulus;
+      NTTMultiplication::PreparedOperand preparedInverse;
+      SizeT n;
+      DataT mPrime;               // −m⁻¹ mod B
+      bool block;
+      bool prepared;
+
+      static vector<DataT> PowerOfB(SizeT limbs)
+      {
+        vector<DataT> v(limbs + 1, 0);
+        v[limbs] = 1;
+        return v;
+      }
+
+      vector<DataT> ProductWithModulus(vector<DataT> const &q) const
+      {
+        if (prepared)
+          return NTTMultiplication::Multiply(preparedModulus, q);
+        return Multiply(q, modulus, CurrentBase);
+      }
+
+      vector<DataT> LowProductWithInverse(vector<DataT> const &t) const
+      {
+        if (!prepared)
+          return LowProduct(t, negInverse, n);
+        vector<DataT> tl(t.begin(), t.begin() + std::min((SizeT)t.size(), n));
+        TrimZeros(tl);
+        if (tl.empty())
+          return vector<DataT>(n, 0);
+        vector<DataT> p = NTTMultiplication::Multiply(preparedInverse, tl);
+        p.resize(n, 0);
+        return p;
+      }
+
+      // t ≥ m → t − m. t has at most n+1 limbs and is < 2m.
+      void FinalSubtract(vector<DataT> &t) const
+      {
+        if (Compare(t, modulus) >= 0)
+          SubtractFrom(t, modulus, CurrentBase);
+        TrimZerosToOne(t);
+      }
+
+      vector<DataT> RedcWord(vector<DataT> const &T) const
+      {
+        vector<DataT> t(2 * n + 1, 0);
+        std::memcpy(t.data(), T.data(), std::min((SizeT)T.size(), (SizeT)(2 * n)) * sizeof(DataT));
+        const DataT *m = modulus.data();
+        DataT *tp = t.data();
+        // Row i adds u·m at limb i; its carry-out lands on t[i+n] and the
+        // overflow of that add rides into the next row's t[i+n+1].
+        ULong overflow = 0;
+        for (SizeT i = 0; i < n; ++i)
+        {
+          ULong u = ((ULong)tp[i] * mPrime) & LimbMask;
+          ULong carry = 0;
+          for (SizeT j = 0; j < n; ++j)
+          {
+            ULong128 p = (ULong128)u * m[j] + tp[i + j] + carry;
+            tp[i + j] = (DataT)(p & LimbMask);
+            carry = (ULong)(p >> LimbBits);
+          }
+          ULong128 s = (ULong128)tp[i + n] + carry + overflow;
+          tp[i + n] = (DataT)(s & LimbMask);
+          overflow = (ULong)(s >> LimbBits);
+        }
+        tp[2 * n] += (DataT)overflow;
+        vector<DataT> r(t.begin() + n, t.end());
+        FinalSubtract(r);
+        return r;
+      }
+
+      vector<DataT> RedcBlock(vector<DataT> const &T) const
+      {
+        vector<DataT> q = LowProductWithInverse(T);
+        TrimZeros(q);
+        vector<DataT> s(2 * n + 1, 0);
+        std::memcpy(s.data(), T.data(), std::min((SizeT)T.size(), (SizeT)(2 * n)) * sizeof(DataT));
+        if (!q.empty())
+          AddTo(s, ProductWithModulus(q), CurrentBase);
+        vector<DataT> r(s.begin() + n, s.end());
+        FinalSubtract(r);
+        return r;
+      }
+
+    public:
+      explicit Context(vector<DataT> const &m)
+          : modulus(m), n(0), mPrime(0), block(false), prepared(false)
+      {
+        TrimZeros(modulus);
+        if (modulus.empty() || (modulus[0] & 1) == 0)
+          throw invalid_argument("Montgomery modulus must be odd");
+
+        n = (SizeT)modulus.size();
+        mPrime = (DataT)((0 - (ULong)InverseLimb(modulus[0])) & LimbMask);
+        block = n >= MONTGOMERY_BLOCK_THRESHOLD;
+        prepared = block && n >= MONTGOMERY_PREPARED_THRESHOLD;
+
+        if (block)
+        {
+          negInverse = InverseModPower(modulus, n);
+          NegateModPower(negInverse);
+        }
+        if (prepared)
+        {
+          preparedModulus = NTTMultiplication::PrepareOperand(modulus, n, CurrentBase);
+          preparedInverse = NTTMultiplication::PrepareOperand(negInverse, n, CurrentBase);
+        }
+
+        rModM = Remainder(PowerOfB(n), modulus, CurrentBase);
+        r2ModM = Remainder(PowerOfB(2 * n), modulus, CurrentBase);
+        TrimZerosToOne(rModM);
+        TrimZerosToOne(r2ModM);
+      }
+
+      // T·R⁻¹ mod m for T < m·R.
+      vector<DataT> Redc(vector<DataT> const &T) const
+      {
+        if (IsZero(T))
+          return vector<DataT>{0};
+        return block ? RedcBlock(T) : RedcWord(T);
+      }
+
+      // x < m → x·R mod m.
+      vector<DataT> ToMontgomery(vector<DataT> const &x) const
+      {
+        return Redc(Multiply(x, r2ModM, CurrentBase));
+      }
+
+      vector<DataT> FromMontgomery(vector<DataT> const &x) const
+      {
+        return Redc(x);
+      }
+
+      // Montgomery-domain product and square: ãb̃·R⁻¹ mod m.
+      vector<DataT> MultiplyReduce(vector<DataT> const &a, vector<DataT> const &b) const
+      {
+        return Redc(Multiply(a, b, CurrentBase));
+      }
+
+      vector<DataT> SquareReduce(vector<DataT> const &a) const
+      {
+        return Redc(Square(a, CurrentBase));
+      }
+
+      // x̃^e in Montgomery form. `exponent` is a plain limb vector.
+      vector<DataT> Pow(vector<DataT> const &x, vector<DataT> const &exponent) const
+      {
+        SizeT bits = BitLength(exponent);
+        if (bits == 0)
+          return rModM;
+
+        SizeT k = WindowBits(bits);
+
+        // odd[i] = x̃^(2i+1)
+        vector<vector<DataT>> odd(1, x);
+        if (k > 1)
+        {
+          vector<DataT> x2 = SquareReduce(x);
+          SizeT count = (SizeT)1 << (k - 1);
+          odd.reserve(count);
+          for (SizeT i = 1; i < count; ++i)
+            odd.push_back(MultiplyReduce(odd.back(), x2));
+        }
+
+        vector<DataT> result;
+        bool started = false;
+        Int i = (Int)bits - 1;
+        while (i >= 0)
+        {
+          if (!TestBit(exponent, (SizeT)i))
+          {
+            result = SquareReduce(result);
+            --i;
+            continue;
+          }
+
+          // Longest window [j..i] of width ≤ k that ends on a set bit.
+          Int j = std::max((Int)0, i - (Int)k + 1);
+          while (!TestBit(exponent, (SizeT)j))
+            ++j;
+          SizeT value = 0;
+          for (Int b = i; b >= j; --b)
+            value = (value << 1) | (SizeT)TestBit(exponent, (SizeT)b);
+
+          if (!started)
+          {
+            result = odd[value >> 1];
+            started = true;
+          }
+          else
+          {
+            for (Int s = 0; s < i - j + 1; ++s)
+              result = SquareReduce(result);
+            result = MultiplyReduce(result, odd[value >> 1]);
+          }
+          i = j - 1;
+        }
+        return result;
+      }
+
+      vector<DataT> const &Modulus() const
+      {
+        return modulus;
+      }
+
+      vector<DataT> const &One() const
+      {
+        return rModM;
+      }
+    };
+
+    static bool TestBit(vector<DataT> const &e, SizeT bit)
+    {
+      SizeT limb = bit / LimbBits;
+      if (limb >= e.size())
+        return false;
+      return (e[limb] >> (bit % LimbBits)) & 1;
+    }
+
+    // Sliding-window width by exponent length; thresholds balance the
+    // 2^(k−1) precomputed odd powers against the multiplies they save.
+    static SizeT WindowBits(SizeT bits)
+    {
+      if (bits <= 8) return 1;
+      if (bits <= 24) return 2;
+      if (bits <= 80) return 3;
+      if (bits <= 240) return 4;
+      if (bits <= 672) return 5;
+      if (bits <= 1792) return 6;
+      return 7;
+    }
+  };
+}
+
+#endif
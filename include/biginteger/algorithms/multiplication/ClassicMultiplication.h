@@ -13,6 +13,7 @@
 using namespace std;
 
 #include "../../common/Util.h"
+#include "CombaMultiplication.h"
 
 namespace BigMath
 {
@@ -293,6 +294,14 @@ namespace BigMath
       SizeT size = (SizeT)(a.size() + b.size() + 1);
       vector<DataT> result(size);
 
+      // Up to 8×8 limbs: fully unrolled column kernel, no per-limb branching.
+      if (CombaMultiplication::Covers((SizeT)a.size(), (SizeT)b.size(), base))
+      {
+        CombaMultiplication::Multiply(a.data(), (SizeT)a.size(), b.data(), (SizeT)b.size(), result.data());
+        TrimZeros(result);
+        return result;
+      }
+
       Multiply(a, 0, (SizeT)a.size() - 1, b, 0, (SizeT)b.size() - 1, result, 0, base);
 
       TrimZeros(result);
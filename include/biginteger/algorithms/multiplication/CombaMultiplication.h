@@ -0,0 +1,152 @@
+/**
+ * BigMath: Compile-time specialized schoolbook kernels for small operands.
+ *
+ * Column-wise (Comba) product r = a · b for every shape lenA × lenB with
+ * both sides in [1, COMBA_MAX_LIMBS]. Each shape is its own template
+ * instantiation: loop bounds, column ranges and the final carry store are
+ * constants, so the compiler fully unrolls the kernel into a straight-line
+ * mul/umulh + add/adc chain with no per-limb branches. Shapes are reached
+ * through a flat function-pointer table indexed by (lenA-1, lenB-1).
+ *
+ * Each column accumulates into a three-word (c0, c1, c2) register triple.
+ * On x86-64 with BMI2+ADX the product/accumulate step uses MULX (which
+ * leaves the flags alone) and the ADCX carry intrinsics, so consecutive
+ * products in a column interleave with the running add chain; elsewhere
+ * the ULong128 form lowers to the same shape (UMULH + ADDS/ADCS on ARM64).
+ *
+ * Base2_64 only. Base2_32 keeps the packed hybrid leaf in Karatsuba and
+ * the row-wise loop in ClassicMultiplication.
+ *
+ * Set -DBIGMATH_COMBA_KERNELS=0 to disable for A/B comparison.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef COMBA_MULTIPLICATION
+#define COMBA_MULTIPLICATION
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "../../common/Util.h"
+
+#if defined(__x86_64__) && defined(__BMI2__) && defined(__ADX__)
+#include <immintrin.h>
+#define BIGMATH_COMBA_USE_ADX 1
+#else
+#define BIGMATH_COMBA_USE_ADX 0
+#endif
+
+#ifndef BIGMATH_COMBA_KERNELS
+#define BIGMATH_COMBA_KERNELS 1
+#endif
+
+namespace BigMath
+{
+  class CombaMultiplication
+  {
+  public:
+    // Largest per-operand limb count covered by the kernel table. 8×8 keeps
+    // the table at 64 entries and the biggest kernel at 64 multiplies.
+    static constexpr SizeT COMBA_MAX_LIMBS = 8;
+
+  private:
+    using KernelFn = void (*)(const DataT *, const DataT *, DataT *);
+
+    // (c2:c1:c0) += x * y
+    static inline __attribute__((always_inline)) void MulAdd(
+        ULong x, ULong y, ULong &c0, ULong &c1, ULong &c2)
+    {
+#if BIGMATH_COMBA_USE_ADX
+      unsigned long long hi;
+      unsigned long long lo = _mulx_u64(x, y, &hi);
+      unsigned long long s0, s1, s2;
+      unsigned char cf = _addcarryx_u64(0, c0, lo, &s0);
+      cf = _addcarryx_u64(cf, c1, hi, &s1);
+      _addcarryx_u64(cf, c2, 0, &s2);
+      c0 = s0;
+      c1 = s1;
+      c2 = s2;
+#else
+      ULong128 p = (ULong128)x * y;
+      ULong128 acc = (((ULong128)c1 << 64) | c0) + p;
+      c2 += (ULong)(acc < p);
+      c0 = (ULong)acc;
+      c1 = (ULong)(acc >> 64);
+#endif
+    }
+
+    // Column K of an NA × NB product: sum of a[i]·b[K-i] over the valid i,
+    // i = LO + I for each I in the pack.
+    template <std::size_t NB, std::size_t K, std::size_t LO, std::size_t... I>
+    static inline __attribute__((always_inline)) void Column(
+        const DataT *a, const DataT *b, DataT *r,
+        ULong &c0, ULong &c1, ULong &c2,
+        std::index_sequence<I...>)
+    {
+      (MulAdd(a[LO + I], b[K - LO - I], c0, c1, c2), ...);
+      r[K] = (DataT)c0;
+      c0 = c1;
+      c1 = c2;
+      c2 = 0;
+    }
+
+    template <std::size_t NA, std::size_t NB, std::size_t... K>
+    static inline __attribute__((always_inline)) void Columns(
+        const DataT *a, const DataT *b, DataT *r,
+        ULong &c0, ULong &c1, ULong &c2,
+        std::index_sequence<K...>)
+    {
+      (Column<NB, K, (K >= NB ? K - NB + 1 : 0)>(
+           a, b, r, c0, c1, c2,
+           std::make_index_sequence<(K < NA ? K : NA - 1) - (K >= NB ? K - NB + 1 : 0) + 1>{}),
+       ...);
+    }
+
+    // r[0..NA+NB-1] = a[0..NA-1] * b[0..NB-1]. Writes every output limb.
+    template <std::size_t NA, std::size_t NB>
+    static void Kernel(const DataT *a, const DataT *b, DataT *r)
+    {
+      ULong c0 = 0, c1 = 0, c2 = 0;
+      Columns<NA, NB>(a, b, r, c0, c1, c2, std::make_index_sequence<NA + NB - 1>{});
+      r[NA + NB - 1] = (DataT)c0;
+    }
+
+    // Row-major jump table: entry (lenA-1)·COMBA_MAX_LIMBS + (lenB-1).
+    template <std::size_t... I>
+    static constexpr std::array<KernelFn, sizeof...(I)> MakeTable(std::index_sequence<I...>)
+    {
+      return {{&Kernel<I / COMBA_MAX_LIMBS + 1, I % COMBA_MAX_LIMBS + 1>...}};
+    }
+
+  public:
+    static inline bool Covers(SizeT lenA, SizeT lenB, BaseT base)
+    {
+#if BIGMATH_COMBA_KERNELS
+      return base == Base2_64 &&
+             lenA >= 1 && lenA <= COMBA_MAX_LIMBS &&
+             lenB >= 1 && lenB <= COMBA_MAX_LIMBS;
+#else
+      (void)lenA;
+      (void)lenB;
+      (void)base;
+      return false;
+#endif
+    }
+
+    // r[0..lenA+lenB-1] = a * b. Caller checks Covers() first; r must not
+    // alias a or b.
+    static inline void Multiply(
+        const DataT *a, SizeT lenA,
+        const DataT *b, SizeT lenB,
+        DataT *r)
+    {
+      static constexpr std::array<KernelFn, COMBA_MAX_LIMBS * COMBA_MAX_LIMBS> table =
+          MakeTable(std::make_index_sequence<COMBA_MAX_LIMBS * COMBA_MAX_LIMBS>{});
+      table[(lenA - 1) * COMBA_MAX_LIMBS + (lenB - 1)](a, b, r);
+    }
+  };
+}
+
+#endif
@@ -15,6 +15,7 @@ using namespace std;
 
 #include "../../common/Util.h"
 #include "../multiplication/ClassicMultiplication.h"
+#include "../multiplication/CombaMultiplication.h"
 
 namespace BigMath
 {
@@ -253,6 +254,14 @@ namespace BigMath
             DataT* r,
             BaseT base)
         {
+            // Small leaves (both sides ≤ 8 limbs, e.g. the tail of a skewed
+            // split) take the unrolled Comba kernel, which writes all of r.
+            if (CombaMultiplication::Covers(lenA, lenB, base))
+            {
+                CombaMultiplication::Multiply(a, lenA, b, lenB, r);
+                return;
+            }
+
             std::memset(r, 0, (lenA + lenB) * sizeof(DataT));
 
             if (base == Base2_32)
@@ -370,6 +379,28 @@ namespace BigMath
                 return;
             }
 
+            // Skewed operands: slice the longer one into chunks of the shorter
+            // length. Splitting at max/2 clipped to min-1 would peel only ~min
+            // limbs per level, giving depth ~max/min and workspace far past 16n.
+            if (la >= 2 * lb || lb >= 2 * la)
+            {
+                if (la > lb)
+                {
+                    std::swap(a, b);
+                    std::swap(la, lb);
+                }
+                std::memset(c, 0, (la + lb) * sizeof(DataT));
+                DataT* t = w;
+                DataT* nextW = w + 2 * la;
+                for (SizeT off = 0; off < lb; off += la)
+                {
+                    SizeT len = std::min(la, lb - off);
+                    MultiplyRecursive(a, la, b + off, len, t, nextW, base);
+                    AddToPtr(c + off, la + lb - off, t, la + len, base);
+                }
+                return;
+            }
+
             SizeT m = (max(la, lb) + 1) / 2;
             if (m >= la) m = la - 1;
             if (m >= lb) m = lb - 1;
@@ -430,6 +461,27 @@ namespace BigMath
         }
 
     public:
+        // Workspace limbs MultiplyInto needs for operands of at most n limbs
+        // (see the sizing note in Multiply).
+        static SizeT WorkspaceLimbs(SizeT n)
+        {
+            return 16 * n;
+        }
+
+        // c[0..lenA+lenB-1] = a * b into caller-owned buffers; w must hold
+        // WorkspaceLimbs(max(lenA, lenB)) limbs. Both lengths ≥ 1; c must not
+        // alias a, b or w. Lets fixed-shape callers (Barrett reduction) run
+        // repeated products without touching the heap.
+        static void MultiplyInto(
+            const DataT* a, SizeT lenA,
+            const DataT* b, SizeT lenB,
+            DataT* c,
+            DataT* w,
+            BaseT base)
+        {
+            MultiplyRecursive(a, lenA, b, lenB, c, w, base);
+        }
+
         static vector<DataT> Multiply(
             vector<DataT> const &a,
             vector<DataT> const &b,
@@ -459,7 +511,7 @@ namespace BigMath
             // 16n is a comfortable upper bound that keeps the workspace within
             // a single allocation and never triggers a heap-buffer-overflow
             // even on adversarially-skewed inputs (e.g. 1200×1024).
-            unique_ptr<DataT[]> w(new DataT[16 * n]);
+            unique_ptr<DataT[]> w(new DataT[WorkspaceLimbs(n)]);
 
             MultiplyRecursive(
                 a.data(), a.size(),
@@ -154,6 +154,39 @@ namespace BigMath
             return NttCrt::Multiply(prepared, other);
         }
 
+        // result ← prepared · other[0, otherLimbs) without allocating once
+        // result has the capacity.
+        static void MultiplyInto(
+            const PreparedOperand &prepared,
+            const DataT *other,
+            SizeT otherLimbs,
+            vector<DataT> &result)
+        {
+            NttCrt::MultiplyInto(prepared, other, otherLimbs, result);
+        }
+
+        // Products modulo B^K − 1 on a transform of length K·CoeffsPerLimb,
+        // half the length of the full product; see NttCrt::MultiplyWrap.
+        static SizeT WrapLimbs(SizeT limbs, BaseT base)
+        {
+            return NttCrt::WrapLimbs(limbs, base);
+        }
+
+        static PreparedOperand PrepareWrap(const vector<DataT> &operand, SizeT K, BaseT base)
+        {
+            return NttCrt::PrepareWrap(operand, K, base);
+        }
+
+        static vector<DataT> MultiplyWrap(const PreparedOperand &prepared, const vector<DataT> &other)
+        {
+            return NttCrt::MultiplyWrap(prepared, other);
+        }
+
+        static vector<DataT> FoldWrap(const vector<DataT> &v, SizeT K, BaseT base)
+        {
+            return NttCrt::FoldWrap(v, K, base);
+        }
+
         // Multiply two vectors of digits using NTT-based convolution.
         static vector<DataT> Multiply(const vector<DataT> &a, const vector<DataT> &b, BaseT base)
         {
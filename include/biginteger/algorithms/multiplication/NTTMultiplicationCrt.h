@@ -68,6 +68,7 @@
 #include <array>
 #include <bit>
 #include <cstdint>
+#include <span>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -583,7 +584,8 @@ namespace BigMath
       return base == Base2_64 ? 2u : 1u;
     }
 
-    inline void PackOperand(const std::vector<DataT> &v,
+    inline void PackOperand(const DataT *v,
+                            SizeT len,
                             BaseT base,
                             std::vector<UInt> &dst1,
                             std::vector<UInt> &dst2,
@@ -591,7 +593,7 @@ namespace BigMath
     {
       if (base == Base2_64)
       {
-        for (SizeT i = 0; i < v.size(); ++i)
+        for (SizeT i = 0; i < len; ++i)
         {
           SizeT j = i * 2;
           UInt lo = (UInt)(v[i] & 0xFFFFFFFFULL);
@@ -604,7 +606,7 @@ namespace BigMath
       else
       {
         // Base2_32: each limb is already a 32-bit value.
-        for (SizeT i = 0; i < v.size(); ++i)
+        for (SizeT i = 0; i < len; ++i)
         {
           UInt vv = (UInt)v[i];
           dst1[i] = vv % P1;
@@ -614,16 +616,25 @@ namespace BigMath
       }
     }
 
-    inline std::vector<DataT> FinalizeProduct(const std::vector<UInt> &fa1,
-                                              const std::vector<UInt> &fa2,
-                                              const std::vector<UInt> &fa3,
-                                              ULong coeffCount,
-                                              BaseT base,
-                                              SizeT reserveLimbs)
+    inline void PackOperand(const std::vector<DataT> &v,
+                            BaseT base,
+                            std::vector<UInt> &dst1,
+                            std::vector<UInt> &dst2,
+                            std::vector<UInt> &dst3)
+    {
+      PackOperand(v.data(), (SizeT)v.size(), base, dst1, dst2, dst3);
+    }
+
+    // result ← the carried, trimmed product; result's capacity is reused.
+    inline void FinalizeProductInto(const std::vector<UInt> &fa1,
+                                    const std::vector<UInt> &fa2,
+                                    const std::vector<UInt> &fa3,
+                                    ULong coeffCount,
+                                    BaseT base,
+                                    std::vector<DataT> &result)
     {
       const InvTable &inv = GarnerInverses();
-      std::vector<DataT> result;
-      result.reserve(reserveLimbs);
+      result.clear();
 
       if (base == Base2_64)
       {
@@ -687,6 +698,18 @@ namespace BigMath
       }
 
       TrimZeros(result);
+    }
+
+    inline std::vector<DataT> FinalizeProduct(const std::vector<UInt> &fa1,
+                                              const std::vector<UInt> &fa2,
+                                              const std::vector<UInt> &fa3,
+                                              ULong coeffCount,
+                                              BaseT base,
+                                              SizeT reserveLimbs)
+    {
+      std::vector<DataT> result;
+      result.reserve(reserveLimbs);
+      FinalizeProductInto(fa1, fa2, fa3, coeffCount, base, result);
       return result;
     }
 
@@ -705,30 +728,13 @@ namespace BigMath
       bool Empty() const { return n == 0 || f1.empty(); }
     };
 
-    inline PreparedOperand PrepareOperand(const std::vector<DataT> &operand,
-                                          SizeT maxOtherLimbs,
-                                          BaseT base)
+    // Pack `operand` into prepared.f1..f3 at length prepared.n and transform.
+    inline void TransformPrepared(PreparedOperand &prepared, const std::vector<DataT> &operand)
     {
-      PreparedOperand prepared;
-      prepared.base = base;
-      prepared.operandLimbs = (SizeT)operand.size();
-      prepared.maxOtherLimbs = maxOtherLimbs;
-      prepared.coeffsPerLimb = CoeffsPerLimb(base);
-
-      if (IsZero(operand))
-        return prepared;
-      if (maxOtherLimbs == 0)
-        throw std::invalid_argument("prepared NTT maxOtherLimbs must be non-zero");
-
-      prepared.operandCoeffSize = (ULong)operand.size() * prepared.coeffsPerLimb;
-      ULong maxOtherCoeffSize = (ULong)maxOtherLimbs * prepared.coeffsPerLimb;
-      ULong maxCoeffCount = prepared.operandCoeffSize + maxOtherCoeffSize - 1;
-      prepared.n = (Int)std::max<ULong>(2, std::bit_ceil(maxCoeffCount));
-
       prepared.f1.assign(prepared.n, 0);
       prepared.f2.assign(prepared.n, 0);
       prepared.f3.assign(prepared.n, 0);
-      PackOperand(operand, base, prepared.f1, prepared.f2, prepared.f3);
+      PackOperand(operand, prepared.base, prepared.f1, prepared.f2, prepared.f3);
 
       const auto &plan1 = GetPlan<F1, G1>(prepared.n);
       const auto &plan2 = GetPlan<F2, G2>(prepared.n);
@@ -758,26 +764,45 @@ namespace BigMath
       Forward<F2>(prepared.f2, plan2);
       Forward<F3>(prepared.f3, plan3);
 #endif
-
-      return prepared;
     }
 
-    inline std::vector<DataT> Multiply(const PreparedOperand &prepared,
-                                       const std::vector<DataT> &other)
+    inline PreparedOperand PrepareOperand(const std::vector<DataT> &operand,
+                                          SizeT maxOtherLimbs,
+                                          BaseT base)
     {
-      if (prepared.Empty() || IsZero(other))
-        return std::vector<DataT>();
-      if (other.size() > prepared.maxOtherLimbs)
-        throw std::invalid_argument("prepared NTT operand exceeds maxOtherLimbs");
+      PreparedOperand prepared;
+      prepared.base = base;
+      prepared.operandLimbs = (SizeT)operand.size();
+      prepared.maxOtherLimbs = maxOtherLimbs;
+      prepared.coeffsPerLimb = CoeffsPerLimb(base);
 
-      ULong otherCoeffSize = (ULong)other.size() * prepared.coeffsPerLimb;
-      ULong coeffCount = prepared.operandCoeffSize + otherCoeffSize - 1;
+      if (IsZero(operand))
+        return prepared;
+      if (maxOtherLimbs == 0)
+        throw std::invalid_argument("prepared NTT maxOtherLimbs must be non-zero");
 
-      static thread_local std::vector<UInt> fb1, fb2, fb3;
+      prepared.operandCoeffSize = (ULong)operand.size() * prepared.coeffsPerLimb;
+      ULong maxOtherCoeffSize = (ULong)maxOtherLimbs * prepared.coeffsPerLimb;
+      ULong maxCoeffCount = prepared.operandCoeffSize + maxOtherCoeffSize - 1;
+      prepared.n = (Int)std::max<ULong>(2, std::bit_ceil(maxCoeffCount));
+
+      TransformPrepared(prepared, operand);
+      return prepared;
+    }
+
+    // fb1..fb3 ← the length-prepared.n cyclic convolution of `other` with
+    // the prepared operand, still split across the three primes.
+    inline void ConvolvePrepared(const PreparedOperand &prepared,
+                                 const DataT *other,
+                                 SizeT otherLimbs,
+                                 std::vector<UInt> &fb1,
+                                 std::vector<UInt> &fb2,
+                                 std::vector<UInt> &fb3)
+    {
       fb1.assign(prepared.n, 0);
       fb2.assign(prepared.n, 0);
       fb3.assign(prepared.n, 0);
-      PackOperand(other, prepared.base, fb1, fb2, fb3);
+      PackOperand(other, otherLimbs, prepared.base, fb1, fb2, fb3);
 
       const auto &plan1 = GetPlan<F1, G1>(prepared.n);
       const auto &plan2 = GetPlan<F2, G2>(prepared.n);
@@ -849,9 +874,131 @@ namespace BigMath
       Inverse<F2>(fb2, plan2);
       Inverse<F3>(fb3, plan3);
 #endif
+    }
+
+    inline void ConvolvePrepared(const PreparedOperand &prepared,
+                                 const std::vector<DataT> &other,
+                                 std::vector<UInt> &fb1,
+                                 std::vector<UInt> &fb2,
+                                 std::vector<UInt> &fb3)
+    {
+      ConvolvePrepared(prepared, other.data(), (SizeT)other.size(), fb1, fb2, fb3);
+    }
+
+    // result ← prepared · other[0, otherLimbs). Transform buffers are
+    // thread-local and result's capacity is reused, so repeated calls at one
+    // size do not allocate.
+    inline void MultiplyInto(const PreparedOperand &prepared,
+                             const DataT *other,
+                             SizeT otherLimbs,
+                             std::vector<DataT> &result)
+    {
+      if (prepared.Empty() || IsZero(std::span<const DataT>(other, otherLimbs)))
+      {
+        result.clear();
+        return;
+      }
+      if (otherLimbs > prepared.maxOtherLimbs)
+        throw std::invalid_argument("prepared NTT operand exceeds maxOtherLimbs");
+
+      ULong otherCoeffSize = (ULong)otherLimbs * prepared.coeffsPerLimb;
+      ULong coeffCount = prepared.operandCoeffSize + otherCoeffSize - 1;
+
+      static thread_local std::vector<UInt> fb1, fb2, fb3;
+      ConvolvePrepared(prepared, other, otherLimbs, fb1, fb2, fb3);
+      FinalizeProductInto(fb1, fb2, fb3, coeffCount, prepared.base, result);
+    }
+
+    inline std::vector<DataT> Multiply(const PreparedOperand &prepared,
+                                       const std::vector<DataT> &other)
+    {
+      std::vector<DataT> result;
+      if (prepared.Empty() || IsZero(other))
+        return result;
+      result.reserve(prepared.operandLimbs + other.size() + 2);
+      MultiplyInto(prepared, other.data(), (SizeT)other.size(), result);
+      return result;
+    }
+
+    // ─── Wrap-around products ────────────────────────────────────────────────
+    //
+    // A length-n transform multiplies modulo x^n − 1; with x = 2^32 that is
+    // modulo B^K − 1 for K = n / CoeffsPerLimb limbs. When the caller knows
+    // the product's high part cancels against something (a remainder or a
+    // Newton correction known to be small), the residue is all it needs, at
+    // half the transform length of the full product. Both operands must fit
+    // in K limbs.
+
+    // K for the shortest transform holding `limbs` limbs.
+    inline SizeT WrapLimbs(SizeT limbs, BaseT base)
+    {
+      SizeT c = CoeffsPerLimb(base);
+      return (SizeT)(std::max<ULong>(2, std::bit_ceil((ULong)limbs * c)) / c);
+    }
 
-      return FinalizeProduct(
-          fb1, fb2, fb3, coeffCount, prepared.base, prepared.operandLimbs + other.size() + 2);
+    // v mod (B^K − 1) as exactly K limbs. B^K − 1 itself may come back as a
+    // representative of zero.
+    inline std::vector<DataT> FoldWrap(const std::vector<DataT> &v, SizeT K, BaseT base)
+    {
+      const ULong mask = base == Base2_64 ? ~0ULL : 0xFFFFFFFFULL;
+      const SizeT bits = base == Base2_64 ? 64 : 32;
+      std::vector<DataT> r(v.begin(), v.begin() + std::min((SizeT)v.size(), K));
+      r.resize(K, 0);
+      ULong carry = 0;
+      for (SizeT start = K; start < v.size(); start += K)
+      {
+        SizeT end = std::min((SizeT)v.size(), start + K);
+        for (SizeT i = 0; i < K; ++i)
+        {
+          ULong128 t = (ULong128)r[i] + (start + i < end ? v[start + i] : 0) + carry;
+          r[i] = (DataT)((ULong)t & mask);
+          carry = (ULong)(t >> bits);
+        }
+      }
+      // B^K ≡ 1: the carry out goes back in at the bottom.
+      while (carry != 0)
+      {
+        for (SizeT i = 0; i < K && carry != 0; ++i)
+        {
+          ULong128 t = (ULong128)r[i] + carry;
+          r[i] = (DataT)((ULong)t & mask);
+          carry = (ULong)(t >> bits);
+        }
+      }
+      return r;
+    }
+
+    inline PreparedOperand PrepareWrap(const std::vector<DataT> &operand, SizeT K, BaseT base)
+    {
+      PreparedOperand prepared;
+      prepared.base = base;
+      prepared.operandLimbs = (SizeT)operand.size();
+      prepared.maxOtherLimbs = K;
+      prepared.coeffsPerLimb = CoeffsPerLimb(base);
+      if (IsZero(operand))
+        return prepared;
+      if (operand.size() > K)
+        throw std::invalid_argument("wrap NTT operand exceeds K limbs");
+
+      prepared.operandCoeffSize = (ULong)operand.size() * prepared.coeffsPerLimb;
+      prepared.n = (Int)(K * prepared.coeffsPerLimb);
+      TransformPrepared(prepared, operand);
+      return prepared;
+    }
+
+    // (prepared · other) mod (B^K − 1), K limbs; `prepared` from PrepareWrap.
+    inline std::vector<DataT> MultiplyWrap(const PreparedOperand &prepared,
+                                           const std::vector<DataT> &other)
+    {
+      SizeT K = prepared.maxOtherLimbs;
+      if (prepared.Empty() || IsZero(other))
+        return std::vector<DataT>(K, 0);
+      if (other.size() > K)
+        throw std::invalid_argument("wrap NTT operand exceeds K limbs");
+
+      static thread_local std::vector<UInt> fb1, fb2, fb3;
+      ConvolvePrepared(prepared, other, fb1, fb2, fb3);
+      return FoldWrap(FinalizeProduct(fb1, fb2, fb3, prepared.n, prepared.base, K + 2), K, prepared.base);
     }
 
 #if BIGMATH_NTT_MFA
@@ -1168,11 +1315,14 @@ namespace BigMath
         for (Int r = rStart; r < rEnd; ++r)
         {
           UInt *row = scratch + (SizeT)r * n2;
+          // Undo the forward twiddle before the row inverse: it was applied
+          // to the row's (bit-reversed) transform output, which is exactly
+          // what the row inverse consumes.
+          MfaTwiddleApplyRow<F>(row, r, n2, n, planN.inverseRoots.data(), br);
           if (n2 <= BIGMATH_NTT_MFA_LEAF)
             InversePtr<F>(row, n2, planN2, /*scale=*/ true);
           else
             InverseMFA<F>(row, n2, a + (SizeT)r * n2, parallel, tree);
-          MfaTwiddleApplyRow<F>(row, r, n2, n, planN.inverseRoots.data(), br);
         }
       };
 #if BIGMATH_USE_THREADS
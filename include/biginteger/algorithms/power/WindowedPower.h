@@ -0,0 +1,128 @@
+/**
+ * BigMath: integer powers by left-to-right sliding-window exponentiation.
+ *
+ * b^e is built from the top bit of e down: a square per bit and, per
+ * window of up to k bits ending on a set bit, one product with a
+ * precomputed odd power b^(2i+1). A single-limb base needs no table: its
+ * multiplies are scalar passes over the result, so plain binary
+ * exponentiation costs the squares alone.
+ *
+ * For a multi-limb base the products are unbalanced (|r| against at most
+ * 2^k·|b|), so windows only pay once r reaches the NTT band, where a
+ * product costs about M(|r|) whatever the shorter side. Below that k = 1.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef WINDOWED_POWER
+#define WINDOWED_POWER
+
+#include <vector>
+using namespace std;
+
+#include "../../common/Util.h"
+#include "../Multiplication.h"
+#include "../Squaring.h"
+#include "../multiplication/ClassicMultiplication.h"
+
+namespace BigMath
+{
+  class WindowedPower
+  {
+  private:
+    static vector<DataT> Squared(vector<DataT> const &x)
+    {
+      vector<DataT> r = Square(x, CurrentBase);
+      TrimZerosToOne(r);
+      return r;
+    }
+
+    static vector<DataT> Product(vector<DataT> const &x, vector<DataT> const &y)
+    {
+      vector<DataT> r = Multiply(x, y, CurrentBase);
+      TrimZerosToOne(r);
+      return r;
+    }
+
+    static SizeT BitLength(ULong e)
+    {
+      return e == 0 ? 0 : (SizeT)(64 - __builtin_clzll(e));
+    }
+
+    // Window width by exponent length once the result reaches the NTT band.
+    static SizeT WindowBits(SizeT bits, ULong resultLimbs)
+    {
+      if (bits <= 8 || resultLimbs < NTT_MULTIPLICATION_THRESHOLD)
+        return 1;
+      if (bits <= 24)
+        return 2;
+      return 3;
+    }
+
+  public:
+    // b^e for b > 1, e ≥ 1.
+    static vector<DataT> Pow(vector<DataT> const &b, ULong e)
+    {
+      SizeT bits = BitLength(e);
+      if (b.size() == 1)
+      {
+        vector<DataT> r = b;
+        for (SizeT i = bits - 1; i-- > 0;)
+        {
+          r = Squared(r);
+          if ((e >> i) & 1)
+            ClassicMultiplication::MultiplyTo(r, b[0], CurrentBase);
+        }
+        return r;
+      }
+
+      SizeT k = WindowBits(bits, (ULong)b.size() * e);
+
+      // odd[i] = b^(2i+1)
+      vector<vector<DataT>> odd(1, b);
+      if (k > 1)
+      {
+        vector<DataT> b2 = Squared(b);
+        SizeT count = (SizeT)1 << (k - 1);
+        odd.reserve(count);
+        for (SizeT i = 1; i < count; ++i)
+          odd.push_back(Product(odd.back(), b2));
+      }
+
+      vector<DataT> r;
+      bool started = false;
+      Int i = (Int)bits - 1;
+      while (i >= 0)
+      {
+        if (!((e >> i) & 1))
+        {
+          r = Squared(r);
+          --i;
+          continue;
+        }
+
+        // Longest window [j..i] of width ≤ k that ends on a set bit.
+        Int j = std::max((Int)0, i - (Int)k + 1);
+        while (!((e >> j) & 1))
+          ++j;
+        SizeT value = (SizeT)((e >> j) & (((ULong)1 << (i - j + 1)) - 1));
+
+        if (!started)
+        {
+          r = odd[value >> 1];
+          started = true;
+        }
+        else
+        {
+          for (Int s = 0; s < i - j + 1; ++s)
+            r = Squared(r);
+          r = Product(r, odd[value >> 1]);
+        }
+        i = j - 1;
+      }
+      return r;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ * BigMath: Karatsuba square root (Zimmermann, "Karatsuba Square Root",
+ * INRIA RR-3805, 1999).
+ *
+ * For a normalized a of 2n limbs (top limb ≥ β/4) split a = a'·β^2l +
+ * a₁·β^l + a₀ with l = ⌊n/2⌋ and recurse on the 2(n − l) top limbs:
+ *
+ *   (s', r') = SqrtRem(a')
+ *   (q, u)   = DivRem(r'·β^l + a₁, 2s')
+ *   s        = s'·β^l + q
+ *   r        = u·β^l + a₀ − q²           if r < 0: r += 2s − 1, s −= 1
+ *
+ * One division of n by n/2 limbs and one square of n/2 limbs per level,
+ * both through the dispatchers, so the cost is a small multiple of M(n).
+ * Two-limb leaves take a floating estimate and one integer Newton step.
+ *
+ * Unnormalized inputs are shifted left by an even bit count 2c (plus a
+ * zero limb when the length is odd); the root is shifted back by c bits
+ * and the remainder recomputed as a − s².
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef KARATSUBA_SQUARE_ROOT
+#define KARATSUBA_SQUARE_ROOT
+
+#include <cmath>
+#include <utility>
+#include <vector>
+using namespace std;
+
+#include "../../common/Comparator.h"
+#include "../../common/Util.h"
+#include "../Addition.h"
+#include "../Division.h"
+#include "../Shift.h"
+#include "../Squaring.h"
+#include "../Subtraction.h"
+
+namespace BigMath
+{
+  class KaratsubaSquareRoot
+  {
+  private:
+    static vector<DataT> Slice(vector<DataT> const &a, SizeT from, SizeT to)
+    {
+      vector<DataT> r(a.begin() + from, a.begin() + to);
+      TrimZerosToOne(r);
+      return r;
+    }
+
+    // ⌊√x⌋ for x < 2^(2·LimbBits).
+    static ULong SqrtTwoLimbs(ULong128 x)
+    {
+      ULong maxRoot = (ULong)LimbMask;
+      double d = std::sqrt((double)x);
+      ULong s = d >= (double)maxRoot ? maxRoot : (ULong)d;
+      if (s != 0)
+      {
+        ULong128 t = ((ULong128)s + x / s) >> 1;
+        s = t > maxRoot ? maxRoot : (ULong)t;
+      }
+      while ((ULong128)s * s > x)
+        --s;
+      while (s < maxRoot && (ULong128)(s + 1) * (s + 1) <= x)
+        ++s;
+      return s;
+    }
+
+    // a has an even number of limbs and a top limb ≥ β/4.
+    static pair<vector<DataT>, vector<DataT>> SqrtRemNormalized(vector<DataT> const &a)
+    {
+      SizeT size = (SizeT)a.size();
+      if (size == 2)
+      {
+        ULong128 x = ((ULong128)a[1] << LimbBits) | a[0];
+        ULong s = SqrtTwoLimbs(x);
+        ULong128 r = x - (ULong128)s * s;
+        vector<DataT> rv{(DataT)(r & LimbMask), (DataT)(r >> LimbBits)};
+        TrimZerosToOne(rv);
+        return {vector<DataT>{(DataT)s}, rv};
+      }
+
+      SizeT n = size / 2;
+      SizeT l = n / 2;
+      auto [s1, r1] = SqrtRemNormalized(vector<DataT>(a.begin() + 2 * l, a.end()));
+
+      // (q, u) = DivRem(r'·β^l + a₁, 2s')
+      vector<DataT> num = ShiftLeft(r1, l);
+      num.resize(std::max((SizeT)num.size(), l), 0);
+      for (SizeT i = 0; i < l; ++i)
+        num[i] = a[l + i];
+      TrimZerosToOne(num);
+      // Divide ⌊num/2⌋ by the normalized s' rather than num by 2s', whose
+      // one-bit top limb is a slow divisor shape: u = 2u' + (num mod 2).
+      DataT low = num[0] & 1;
+      auto [q, u] = DivideAndRemainder(ShiftRightBits(num, 1), s1, CurrentBase);
+      TrimZerosToOne(q);
+      u = ShiftLeftBits(u, 1);
+      u[0] |= low;
+
+      // s = s'·β^l + q, r = u·β^l + a₀ − q²
+      vector<DataT> s = Add(ShiftLeft(s1, l), q, CurrentBase);
+      TrimZerosToOne(s);
+      vector<DataT> r = Add(ShiftLeft(u, l), Slice(a, 0, l), CurrentBase);
+      TrimZerosToOne(r);
+      vector<DataT> q2 = IsZero(q) ? vector<DataT>{0} : Square(q, CurrentBase);
+      TrimZerosToOne(q2);
+      if (Compare(r, q2) < 0)
+      {
+        // r + 2s − 1 ≥ q², s − 1
+        r = Add(r, Add(s, s, CurrentBase), CurrentBase);
+        TrimZerosToOne(r);
+        SubtractFrom(r, (ULong)1, CurrentBase);
+        SubtractFrom(s, (ULong)1, CurrentBase);
+        TrimZerosToOne(s);
+      }
+      SubtractFrom(r, q2, CurrentBase);
+      TrimZerosToOne(r);
+      return {std::move(s), std::move(r)};
+    }
+
+  public:
+    // (⌊√a⌋, a − ⌊√a⌋²).
+    static pair<vector<DataT>, vector<DataT>> SqrtRem(vector<DataT> a)
+    {
+      TrimZerosToOne(a);
+      if (IsZero(a))
+        return {vector<DataT>{0}, vector<DataT>{0}};
+
+      // Even bit shift 2c: top limb ≥ β/4 and an even limb count.
+      SizeT top = BitLength(a) - ((SizeT)a.size() - 1) * LimbBits;
+      SizeT shift = (LimbBits - top) & ~(SizeT)1;
+      if (a.size() % 2 == 1)
+        shift += LimbBits;
+      if (shift == 0)
+        return SqrtRemNormalized(a);
+
+      vector<DataT> an = ShiftLeftBits(a, shift);
+      an.resize(a.size() + (a.size() % 2), 0);
+      vector<DataT> s = ShiftRightBits(SqrtRemNormalized(an).first, shift / 2);
+      vector<DataT> r = a;
+      SubtractFrom(r, Square(s, CurrentBase), CurrentBase);
+      TrimZerosToOne(r);
+      return {std::move(s), std::move(r)};
+    }
+  };
+}
+
+#endif
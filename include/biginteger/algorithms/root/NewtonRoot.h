@@ -0,0 +1,206 @@
+/**
+ * BigMath: k-th root by Newton iteration with precision doubling.
+ *
+ * The floor root x of an n-bit root is built from the floor root x₀ of
+ * a >> k·t, the top half of the problem (t ≈ n/2 bits dropped):
+ *
+ *   x = (x₀ + 1)·2^t                     an overestimate of ⌊a^(1/k)⌋
+ *   x ← ⌊((k − 1)·x + ⌊a / x^(k−1)⌋) / k⌋   until x^k ≤ a
+ *
+ * Started from above, the integer iteration decreases monotonically to
+ * the floor root. The seed is correct to a few bits past n/2, so a level
+ * usually needs one step and one k-th power to confirm it: the precision
+ * doubles per level and the total cost is a constant number of full-size
+ * k-th powers and divisions.
+ * Roots of at most ROOT_BASECASE_BITS bits start from a rounded-up
+ * floating estimate of 2^(log₂ a / k), checked against a and replaced
+ * by 2^n if it is not above the root.
+ *
+ * Powers go through the Square / Multiply dispatchers and the divisions
+ * through DivideAndRemainder. a / x^(k−1) only needs a quotient of about
+ * n bits, so both operands are cut to that length first (rounding the
+ * quotient up keeps the iterates above the root).
+ *
+ * Every step divides by a new x^(k−1), so no cached reciprocal outlives a
+ * step. What carries over is the power: each level's first x^(k−1) is the
+ * shifted (x₀ + 1)^(k−1) of the half-length root, and a confirmation
+ * check that fails leaves x^(k−1) for the next step.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef NEWTON_ROOT
+#define NEWTON_ROOT
+
+#include <cmath>
+#include <utility>
+#include <vector>
+using namespace std;
+
+#include "../../common/Comparator.h"
+#include "../../common/Util.h"
+#include "../Addition.h"
+#include "../Division.h"
+#include "../Multiplication.h"
+#include "../Shift.h"
+#include "../Squaring.h"
+#include "../Subtraction.h"
+#include "KaratsubaSquareRoot.h"
+
+namespace BigMath
+{
+  class NewtonRoot
+  {
+  public:
+    static const SizeT ROOT_BASECASE_BITS = 64;
+
+  private:
+    static vector<DataT> Trimmed(vector<DataT> v)
+    {
+      TrimZerosToOne(v);
+      return v;
+    }
+
+    // x^e for e ≥ 1, left-to-right binary powering.
+    static vector<DataT> Power(vector<DataT> const &x, SizeT e)
+    {
+      vector<DataT> r = x;
+      SizeT bit = 31 - __builtin_clz(e);
+      while (bit-- > 0)
+      {
+        r = Trimmed(Square(r, CurrentBase));
+        if ((e >> bit) & 1)
+          r = Trimmed(Multiply(r, x, CurrentBase));
+      }
+      return r;
+    }
+
+    static vector<DataT> PowerOfTwo(SizeT bits)
+    {
+      vector<DataT> r(bits / LimbBits + 1, 0);
+      r.back() = (DataT)1 << (bits % LimbBits);
+      return r;
+    }
+
+    // Seed above ⌊a^(1/k)⌋ for a root of n ≤ ROOT_BASECASE_BITS bits.
+    static vector<DataT> Seed(vector<DataT> const &a, SizeT k, SizeT n)
+    {
+      SizeT bits = BitLength(a);
+      SizeT drop = bits > 64 ? bits - 64 : 0;
+      vector<DataT> top = ShiftRightBits(a, drop);
+      ULong m = 0;
+      for (SizeT i = (SizeT)top.size(); i-- > 0;)
+        m = (ULong)(((ULong128)m << LimbBits) | top[i]);
+      double estimate = std::exp2(((double)drop + std::log2((double)m)) / (double)k);
+      estimate = estimate * (1 + 1e-9) + 2;
+      if (estimate < std::ldexp(1.0, (int)n))
+      {
+        ULong128 e = (ULong128)estimate;
+        vector<DataT> x = Trimmed(vector<DataT>{(DataT)(e & LimbMask), (DataT)(e >> LimbBits),
+                                                (DataT)((e >> LimbBits) >> LimbBits)});
+        if (Compare(Power(x, k), a) > 0)
+          return x;
+      }
+      return PowerOfTwo(n);
+    }
+
+    // q ≥ ⌊a / p⌋, at most a couple of units above. When p is much longer
+    // than the quotient both are truncated to the quotient's length plus
+    // about a limb: ⌊(A + 1) / P⌋ + 1 > a / p for A = a >> sh, P = p >> sh. This
+    // keeps the division balanced; an exact quotient would pay for p's
+    // full length.
+    static vector<DataT> QuotientAbove(vector<DataT> const &a, vector<DataT> const &p)
+    {
+      SizeT bitsA = BitLength(a);
+      SizeT bitsP = BitLength(p);
+      SizeT bitsQ = bitsA >= bitsP ? bitsA - bitsP + 1 : 1;
+      if (bitsP <= bitsQ + 2 * LimbBits)
+        return Trimmed(DivideAndRemainder(a, p, CurrentBase, false).first);
+
+      // P keeps whole limbs with its top bit set, so the divider's
+      // normalization shift cannot push A past 2·|P| limbs.
+      SizeT keep = (bitsQ + 2 * LimbBits - 1) / LimbBits * LimbBits;
+      SizeT sh = bitsP - keep;
+      vector<DataT> A = Trimmed(Add(ShiftRightBits(a, sh), vector<DataT>{1}, CurrentBase));
+      vector<DataT> P = ShiftRightBits(p, sh);
+      vector<DataT> q = Trimmed(DivideAndRemainder(A, P, CurrentBase, false).first);
+      return Trimmed(Add(q, vector<DataT>{1}, CurrentBase));
+    }
+
+    // One Newton step from x ≥ 1 with p = x^(k−1), never below
+    // ⌊((k − 1)·x + ⌊a / x^(k−1)⌋) / k⌋.
+    static vector<DataT> Step(vector<DataT> const &a, SizeT k, vector<DataT> const &x,
+                              vector<DataT> const &p)
+    {
+      vector<DataT> y = Trimmed(Multiply(x, vector<DataT>{(DataT)(k - 1)}, CurrentBase));
+      y = Trimmed(Add(y, QuotientAbove(a, p), CurrentBase));
+      return Trimmed(Divide(y, (DataT)k, CurrentBase));
+    }
+
+    // (⌊a^(1/k)⌋, ⌊a^(1/k)⌋^k) for a > 0, k ≥ 3.
+    static pair<vector<DataT>, vector<DataT>> Root(vector<DataT> const &a, SizeT k)
+    {
+      SizeT bits = BitLength(a);
+      SizeT n = (bits + k - 1) / k;
+      if (n <= 1)
+        return {vector<DataT>{1}, vector<DataT>{1}};
+      vector<DataT> x, p; // p = x^(k−1)
+      if (n <= ROOT_BASECASE_BITS)
+      {
+        x = Seed(a, k, n);
+        p = Power(x, k - 1);
+      }
+      else
+      {
+        // A few guard bits past n/2 keep the first step within one unit.
+        // The seed's power comes from the half-length root: (x₀ + 1)^(k−1)
+        // shifted, instead of a full-length power of x.
+        SizeT guard = (SizeT)(32 - __builtin_clz(k)) + 2;
+        SizeT t = n / 2 > 2 * guard ? n / 2 - guard : n / 2;
+        x = Root(ShiftRightBits(a, k * t), k).first;
+        x = Trimmed(Add(x, vector<DataT>{1}, CurrentBase));
+        p = ShiftLeftBits(Power(x, k - 1), t * (k - 1));
+        x = ShiftLeftBits(x, t);
+      }
+
+      // Every iterate stays ≥ the root, so the first with x^k ≤ a is it.
+      // x is above the root on entry and after each failed check; a step
+      // stalled by the rounded-up quotient falls back to x − 1. The check
+      // builds x^k from x^(k−1), which the next step reuses.
+      while (true)
+      {
+        vector<DataT> y = Step(a, k, x, p);
+        if (Compare(y, x) >= 0)
+        {
+          y = x;
+          SubtractFrom(y, (ULong)1, CurrentBase);
+          TrimZerosToOne(y);
+        }
+        x = std::move(y);
+        p = Power(x, k - 1);
+        vector<DataT> xk = Trimmed(Multiply(p, x, CurrentBase));
+        if (Compare(xk, a) <= 0)
+          return {std::move(x), std::move(xk)};
+      }
+    }
+
+  public:
+    // (⌊a^(1/k)⌋, a − ⌊a^(1/k)⌋^k) for k ≥ 1.
+    static pair<vector<DataT>, vector<DataT>> RootRem(vector<DataT> a, SizeT k)
+    {
+      TrimZerosToOne(a);
+      if (k == 1 || IsZero(a))
+        return {a, vector<DataT>{0}};
+      if (k == 2)
+        return KaratsubaSquareRoot::SqrtRem(a);
+
+      auto [x, p] = Root(a, k);
+      vector<DataT> r = a;
+      SubtractFrom(r, p, CurrentBase);
+      TrimZerosToOne(r);
+      return {std::move(x), std::move(r)};
+    }
+  };
+}
+
+#endif
@@ -33,6 +33,12 @@ namespace BigMath
     static BigInteger From(std::string const &n) { return From(n.c_str()); }
     static BigInteger From(char const *num)      { return Parse(num); }
 
+    // Hex and binary are linear in the digit count (see ParseRadixPow2);
+    // FromRadix takes any radix from 2 to 62 (see ParseRadix).
+    static BigInteger FromHex(std::string const &n)                 { return ParseHex(n.c_str()); }
+    static BigInteger FromBinary(std::string const &n)              { return ParseBinary(n.c_str()); }
+    static BigInteger FromRadix(std::string const &n, SizeT radix)  { return ParseRadix(n.c_str(), radix); }
+
     // Convert from long double.
     static BigInteger From(long double value)
     {
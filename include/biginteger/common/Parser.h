@@ -6,16 +6,27 @@
  *   Parsing:
  *     ParseUnsignedLinear      — 18-digit chunk accumulation, O(L²) but tight
  *     ParseUnsignedDivideConquer — D&C using cached Pow10, O(M(L) · log L)
+ *     ParseChunk               — 16 digits per step with SSE4.1, 8 with SWAR;
+ *                                FindRange validates 8–32 bytes per step
  *
  *   Formatting:
  *     ToStringLinearAppend     — divmod-10^18 loop, O(L²)
  *     ToStringDivConquer       — D&C using Newton-Divider chain, O(M(L) · log L)
  *
+ *   Power-of-two radixes (2, 4, 8, 16, 32):
+ *     ParseUnsignedPow2 / ToStringPow2 — bit packing, O(L); hex and binary
+ *                                         eight digits per step (SWAR)
+ *
+ *   Any radix 2 to 62:
+ *     ParseUnsignedRadix / ToStringRadix — the decimal algorithms with radix^k
+ *                                           chunks, RadixPower and per-radix
+ *                                           divider chains, O(M(L) · log L)
+ *
  * Thresholds:
  *     DecimalDcThreshold       — parse linear→D&C cutoff (8192 digits)
  *     ToStringDcThreshold      — format linear→D&C cutoff (2048 digits)
  *
- * Caches (`Pow10`) and chain-builder helpers live in the .cpp with internal-linkage
+ * Caches (`RadixPower`, of which `Pow10` is radix 10) and chain-builder helpers live in the .cpp with internal-linkage
  * `static thread_local` storage that is shared across all callers in the same TU.
  *
  * S. M. Mahbub Murshed (murshed@gmail.com)
@@ -41,6 +52,13 @@ namespace BigMath
   inline constexpr SizeT Base10_19_Zeroes = 19;
   inline constexpr SizeT DecimalDcThreshold = 8192;
 
+  // Decimal digit scans and chunk conversion take 8 digits per step (SWAR),
+  // 16 with SSE4.1 and scan 32 with AVX2. Set -DBIGMATH_PARSE_SIMD=0 to go a
+  // digit at a time for A/B comparison.
+#ifndef BIGMATH_PARSE_SIMD
+#define BIGMATH_PARSE_SIMD 1
+#endif
+
 #ifndef BIGMATH_TOSTR_DC_THRESHOLD
 #define BIGMATH_TOSTR_DC_THRESHOLD 2048
 #endif
@@ -63,6 +81,49 @@ namespace BigMath
   BigInteger Parse(char const *num, Int start, Int *char_processed = nullptr);
   BigInteger Parse(char const *num, Int *char_processed = nullptr);
 
+  // ─── power-of-two radixes ───────────────────────────────────────────────────
+  // Radix 2^k for k = 1..5. Each digit is k bits of the value, so no
+  // arithmetic is needed either way. Digits are 0-9 then a-v, upper case
+  // accepted; no "0x"/"0b" prefix. Other radixes throw invalid_argument.
+  SizeT RadixBits(SizeT radix);
+
+  // Digits num[start..end], all valid in the radix.
+  std::vector<DataT> ParseUnsignedPow2(char const *num, Int start, Int end, SizeT radix);
+
+  // Optional sign, then digits up to the first character outside the radix.
+  BigInteger ParseRadixPow2(char const *num, SizeT radix, Int *char_processed = nullptr);
+  BigInteger ParseHex(char const *num, Int *char_processed = nullptr);
+  BigInteger ParseBinary(char const *num, Int *char_processed = nullptr);
+
+  // Lower-case digits, no prefix, "-" for negatives.
+  std::string ToStringPow2(std::vector<DataT> const &bigInt, SizeT radix, bool isNeg = false);
+  std::string ToStringPow2(BigInteger const &bigInt, SizeT radix);
+  std::string ToHex(std::vector<DataT> const &bigInt, bool isNeg = false);
+  std::string ToHex(BigInteger const &bigInt);
+  std::string ToBinary(std::vector<DataT> const &bigInt, bool isNeg = false);
+  std::string ToBinary(BigInteger const &bigInt);
+
+  // ─── any radix ──────────────────────────────────────────────────────────────
+  // Radix 2 to 62. Up to 36 the digits are 0-9 then a-z, either case; above
+  // 36 they are 0-9, A-Z, a-z and case matters (GMP's convention). Decimal
+  // and power-of-two radixes take the paths above. Other radixes use the
+  // decimal algorithms with the thresholds scaled to the same bit length.
+  // Radixes outside 2..62 throw invalid_argument.
+  inline constexpr SizeT MaxRadix = 62;
+
+  // radix^digits, memoized per radix and thread; Pow10 is RadixPower(10, ·).
+  std::vector<DataT> RadixPower(SizeT radix, SizeT digits);
+
+  // Digits num[start..end], all valid in the radix.
+  std::vector<DataT> ParseUnsignedRadix(char const *num, Int start, Int end, SizeT radix);
+
+  // Optional sign, then digits up to the first character outside the radix.
+  BigInteger ParseRadix(char const *num, SizeT radix, Int *char_processed = nullptr);
+
+  // No prefix, "-" for negatives; lower-case letters up to radix 36.
+  std::string ToStringRadix(std::vector<DataT> const &bigInt, SizeT radix, bool isNeg = false);
+  std::string ToStringRadix(BigInteger const &bigInt, SizeT radix);
+
   // ─── formatting ─────────────────────────────────────────────────────────────
   // Appends to `out`. padTo > 0 pads with leading zeros to exactly padTo digits.
   void ToStringLinearAppend(std::vector<DataT> r, SizeT padTo, std::string &out);
@@ -0,0 +1,112 @@
+/**
+ * BigMath: Seedable limb generator for random operands.
+ *
+ * xoshiro256** (Blackman & Vigna) run as four independent lanes in
+ * structure-of-arrays form, so Fill steps all four at once and the loop
+ * vectorizes. Outputs are the lanes interleaved: Next and Fill draw from the
+ * same sequence, however the calls are mixed.
+ *
+ * Split(k) derives an independent generator for stream k from the seed
+ * alone, so work divided into numbered blocks is reproducible whatever the
+ * thread count.
+ *
+ * Not cryptographically secure.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_RANDOM
+#define BIGINTEGER_RANDOM
+
+#include "Util.h"
+
+namespace BigMath
+{
+  class RandomGenerator
+  {
+  public:
+    static constexpr SizeT Lanes = 4;
+
+    explicit RandomGenerator(ULong seed = 0) : seed(seed), used(Lanes)
+    {
+      ULong x = seed;
+      for (SizeT j = 0; j < Lanes; ++j)
+      {
+        s0[j] = SplitMix(x);
+        s1[j] = SplitMix(x);
+        s2[j] = SplitMix(x);
+        s3[j] = SplitMix(x);
+      }
+    }
+
+    // Independent generator for stream k of this seed.
+    RandomGenerator Split(ULong k) const
+    {
+      ULong x = seed ^ (k + 1) * 0xD1B54A32D192ED03ull;
+      return RandomGenerator(SplitMix(x));
+    }
+
+    ULong Next()
+    {
+      if (used == Lanes)
+      {
+        Step(buffer);
+        used = 0;
+      }
+      return buffer[used++];
+    }
+
+    // out[0..n) ← the next n limbs, each uniform below the limb base.
+    void Fill(DataT *out, SizeT n)
+    {
+      SizeT i = 0;
+      while (i < n && used < Lanes)
+        out[i++] = buffer[used++] & LimbMask;
+      for (; i + Lanes <= n; i += Lanes)
+      {
+        ULong r[Lanes];
+        Step(r);
+        for (SizeT j = 0; j < Lanes; ++j)
+          out[i + j] = r[j] & LimbMask;
+      }
+      for (; i < n; ++i)
+        out[i] = Next() & LimbMask;
+    }
+
+  private:
+    static ULong SplitMix(ULong &x)
+    {
+      ULong z = (x += 0x9E3779B97F4A7C15ull);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      return z ^ (z >> 31);
+    }
+
+    static ULong Rotl(ULong x, int k)
+    {
+      return (x << k) | (x >> (64 - k));
+    }
+
+    void Step(ULong *r)
+    {
+      for (SizeT j = 0; j < Lanes; ++j)
+      {
+        r[j] = Rotl(s1[j] * 5, 7) * 9;
+        ULong t = s1[j] << 17;
+        s2[j] ^= s0[j];
+        s3[j] ^= s1[j];
+        s1[j] ^= s2[j];
+        s0[j] ^= s3[j];
+        s2[j] ^= t;
+        s3[j] = Rotl(s3[j], 45);
+      }
+    }
+
+    ULong seed;
+    ULong s0[Lanes], s1[Lanes], s2[Lanes], s3[Lanes];
+    ULong buffer[Lanes];
+    SizeT used;
+  };
+}
+
+#endif
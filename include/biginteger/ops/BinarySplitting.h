@@ -0,0 +1,79 @@
+/**
+ * BigMath: Binary splitting for hypergeometric-type series.
+ *
+ * Evaluates
+ *
+ *   S = Σ_{n=n1}^{n2−1} a(n) · p(n1)···p(n) / (q(n1)···q(n))
+ *
+ * exactly as S = T / Q with P = Πp, Q = Πq over the range, merging halves
+ * [n1, m) and [m, n2) with
+ *
+ *   P = Pl·Pr,  Q = Ql·Qr,  T = Tl·Qr + Pl·Tr.
+ *
+ * Leaves are single terms (P, Q, T) = (p, q, a·p). The range is split at
+ * its midpoint, so sibling subtrees have about the same operand sizes and
+ * every merge is a balanced product. P is skipped on the right spine,
+ * where no parent reads it. Pl and Qr each feed two products, so from the
+ * NTT band they are transformed once (PreparedMultiplication). Equal
+ * halves (constant p or q) are squared.
+ *
+ * Ranges of at least BINARY_SPLITTING_PARALLEL_TERMS terms are cut into
+ * one subrange per pool thread; the subtrees run concurrently and the
+ * top merges run on the caller, where the NTT itself is parallel. The
+ * generator must then be safe to call from several threads.
+ *
+ * Quotient() turns the result into ⌊scale · T / Q⌋, through Newton
+ * division once Q reaches NEWTON_MEDIUM_B limbs.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_BINARY_SPLITTING
+#define BIGINTEGER_BINARY_SPLITTING
+
+#include <functional>
+
+#include "../BigInteger.h"
+
+#ifndef BIGMATH_BINARY_SPLITTING_PARALLEL_TERMS
+// Terms at which Evaluate runs subtrees across the thread pool.
+#define BIGMATH_BINARY_SPLITTING_PARALLEL_TERMS 1024
+#endif
+
+namespace BigMath
+{
+  class BinarySplitting
+  {
+  public:
+    static const SizeT BINARY_SPLITTING_PARALLEL_TERMS = BIGMATH_BINARY_SPLITTING_PARALLEL_TERMS;
+
+    // One term of the series: a(n), p(n), q(n). q must be non-zero.
+    struct Term
+    {
+      BigInteger p;
+      BigInteger q;
+      BigInteger a;
+    };
+
+    // S = T / Q over the evaluated range; P = Πp (empty when not requested).
+    struct Result
+    {
+      BigInteger P;
+      BigInteger Q;
+      BigInteger T;
+    };
+
+    using Generator = std::function<Term(ULong n)>;
+
+    // (P, Q, T) over [n1, n2), n1 < n2. P is filled only if needP.
+    static Result Evaluate(Generator const &term, ULong n1, ULong n2, bool needP = false);
+
+    // ⌊scale · T / Q⌋ (toward zero for negative sums).
+    static BigInteger Quotient(Result const &result, BigInteger const &scale);
+
+    // Merge of adjacent ranges [n1, m) and [m, n2).
+    static Result Merge(Result const &left, Result const &right, bool needP);
+  };
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * BigMath: BigInteger bitwise operations.
+ *
+ * Values behave as infinite two's complement, as in GMP: −1 is all ones,
+ * and a & b, a | b, a ^ b, ~a = −a − 1 follow from that. Storage stays
+ * sign-magnitude; negative operands are converted limb by limb inside the
+ * kernels (algorithms/Bitwise.h).
+ *
+ * Counts that are infinite for the given signs (PopCount of a negative
+ * value, HammingDistance across signs, TrailingZeroBits of zero) return
+ * ~0, as GMP does.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_BITWISE
+#define BIGINTEGER_BITWISE
+
+#include "../BigInteger.h"
+#include "../algorithms/Bitwise.h"
+
+namespace BigMath
+{
+  BigInteger operator&(BigInteger const &a, BigInteger const &b);
+  BigInteger operator|(BigInteger const &a, BigInteger const &b);
+  BigInteger operator^(BigInteger const &a, BigInteger const &b);
+  BigInteger operator~(BigInteger const &a);
+
+  // Bit i of the two's complement form.
+  bool TestBit(BigInteger const &a, ULong i);
+
+  // a with bit i set or cleared.
+  BigInteger SetBit(BigInteger const &a, ULong i);
+  BigInteger ClearBit(BigInteger const &a, ULong i);
+
+  // Set bits of a ≥ 0.
+  ULong PopCount(BigInteger const &a);
+
+  // Differing bits of a and b of the same sign.
+  ULong HammingDistance(BigInteger const &a, BigInteger const &b);
+
+  // Bits in |a|; 0 for zero.
+  ULong BitLength(BigInteger const &a);
+
+  // Index of the lowest set bit (the same for a and −a).
+  ULong TrailingZeroBits(BigInteger const &a);
+}
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * BigMath: BigInteger factorial, binomial and primorial.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_COMBINATORICS
+#define BIGINTEGER_COMBINATORICS
+
+#include "../BigInteger.h"
+#include "../algorithms/Combinatorics.h"
+
+namespace BigMath
+{
+  // n!.
+  BigInteger Factorial(ULong n);
+
+  // C(n, k) = n! / (k!·(n − k)!); zero for k > n.
+  BigInteger Binomial(ULong n, ULong k);
+
+  // n# = product of the primes p ≤ n.
+  BigInteger Primorial(ULong n);
+}
+
+#endif
@@ -7,7 +7,10 @@
 #ifndef BIGINTEGER_DIVISION
 #define BIGINTEGER_DIVISION
 
+#include <cstdint>
+#include <span>
 #include <utility>
+#include <vector>
 
 #include "../BigInteger.h"
 #include "../algorithms/Division.h"
@@ -21,6 +24,11 @@ namespace BigMath
     BigInteger divisor;
     ReciprocalDivision::Divider divider;
 
+    CachedDivision(BigInteger const &b, ReciprocalDivision::Divider d)
+        : divisor(b), divider(std::move(d))
+    {
+    }
+
   public:
     CachedDivision(BigInteger const &b)
         : divisor(b),
@@ -44,10 +52,36 @@ namespace BigMath
       return BigInteger(qv, a.IsNegative() != divisor.IsNegative());
     }
 
+    // Same value and sign as a % Divisor(), without the quotient.
+    BigInteger Remainder(BigInteger const &a) const
+    {
+      auto rv = divider.Remainder(a.GetInteger());
+      return BigInteger(rv, a.IsNegative() || divisor.IsNegative());
+    }
+
     BigInteger const &Divisor() const
     {
       return divisor;
     }
+
+    // The divisor, its sign and its reciprocal as a versioned binary blob
+    // (format in NewtonDivision.h). Deserialize restores the divider without
+    // recomputing the reciprocal, so a service with fixed moduli can save
+    // them once and load them on each start, from a file or an mmap of one.
+    // includeTransforms also stores the NTT spectra of large divisors, which
+    // trades blob size for the two transforms otherwise run on load.
+    std::vector<uint8_t> Serialize(bool includeTransforms = false) const
+    {
+      return divider.Serialize(includeTransforms, divisor.IsNegative());
+    }
+
+    static CachedDivision Deserialize(std::span<const uint8_t> blob)
+    {
+      bool negative = false;
+      ReciprocalDivision::Divider d = ReciprocalDivision::Divider::Deserialize(blob, &negative);
+      BigInteger b(d.Divisor(), negative);
+      return CachedDivision(b, std::move(d));
+    }
   };
 
   inline CachedDivision CacheDivision(BigInteger const &b)
@@ -59,6 +93,16 @@ namespace BigMath
   BigInteger Divide(BigInteger const &a, BigInteger const &b);
   BigInteger operator/(BigInteger const &a, BigInteger const &b);
   BigInteger operator%(BigInteger const &a, BigInteger const &b);
+
+  // a % b without forming the quotient.
+  BigInteger Remainder(BigInteger const &a, BigInteger const &b);
+
+  // Whether b divides a; signs are ignored.
+  bool IsDivisibleBy(BigInteger const &a, BigInteger const &b);
+
+  // a / b when b is known to divide a, from the low limbs up. Cheaper than
+  // Divide; the result is unspecified when the division is not exact.
+  BigInteger DivExact(BigInteger const &a, BigInteger const &b);
 }
 
 #endif
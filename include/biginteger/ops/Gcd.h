@@ -0,0 +1,23 @@
+/**
+ * BigMath: BigInteger GCD and extended GCD.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_GCD
+#define BIGINTEGER_GCD
+
+#include "../BigInteger.h"
+#include "../algorithms/Gcd.h"
+
+namespace BigMath
+{
+  // Non-negative gcd(|a|, |b|); Gcd(0, 0) = 0.
+  BigInteger Gcd(BigInteger const &a, BigInteger const &b);
+
+  // Returns g = gcd(|a|, |b|) and sets s, t with s·a + t·b = g.
+  BigInteger ExtendedGcd(BigInteger const &a, BigInteger const &b,
+                         BigInteger &s, BigInteger &t);
+}
+
+#endif
@@ -0,0 +1,93 @@
+/**
+ * BigMath: Modular arithmetic over a fixed modulus.
+ *
+ * MontgomeryContext keeps the precomputation for one odd modulus (R² mod m,
+ * −m⁻¹, and the prepared NTT spectra for large moduli) and reuses it across
+ * ModMul / ModSqr / ModPow calls. Results are always reduced into [0, m).
+ *
+ * BarrettReducer is the repeated `x % m` fast path: it keeps μ = ⌊B^2k/m⌋
+ * and reduces without forming a quotient.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_MODULAR
+#define BIGINTEGER_MODULAR
+
+#include "../BigInteger.h"
+#include "../algorithms/modular/BarrettReduction.h"
+#include "../algorithms/modular/MontgomeryReduction.h"
+
+namespace BigMath
+{
+  class MontgomeryContext
+  {
+  private:
+    BigInteger modulus;
+    MontgomeryReduction::Context context;
+
+    // a mod m in [0, m), any sign.
+    vector<DataT> Reduce(BigInteger const &a) const;
+
+  public:
+    // Throws invalid_argument unless m is positive and odd.
+    explicit MontgomeryContext(BigInteger const &m);
+
+    // Montgomery form a·R mod m, and back.
+    BigInteger ToMontgomery(BigInteger const &a) const;
+    BigInteger FromMontgomery(BigInteger const &a) const;
+
+    // Products of values already in Montgomery form (a·b·R⁻¹ mod m).
+    BigInteger MontgomeryMultiply(BigInteger const &a, BigInteger const &b) const;
+    BigInteger MontgomerySquare(BigInteger const &a) const;
+
+    // Plain-domain entry points: a·b mod m, a² mod m, a^e mod m.
+    BigInteger ModMul(BigInteger const &a, BigInteger const &b) const;
+    BigInteger ModSqr(BigInteger const &a) const;
+    BigInteger ModPow(BigInteger const &a, BigInteger const &exponent) const;
+
+    BigInteger const &Modulus() const
+    {
+      return modulus;
+    }
+  };
+
+  class BarrettReducer
+  {
+  private:
+    BigInteger modulus;
+    BarrettReduction::Reducer reducer;
+
+  public:
+    explicit BarrettReducer(BigInteger const &m)
+        : modulus(m),
+          reducer(m.GetInteger())
+    {
+    }
+
+    // Same value and sign as x % m. Barrett for |x| < B^2k (k = limbs of m),
+    // the cached reciprocal divider above that.
+    BigInteger Reduce(BigInteger const &x)
+    {
+      vector<DataT> r;
+      reducer.Reduce(x.GetInteger(), r);
+      return BigInteger(r, x.IsNegative() || modulus.IsNegative());
+    }
+
+    BigInteger const &Modulus() const
+    {
+      return modulus;
+    }
+  };
+
+  // x in [0, |m|) with a·x ≡ 1 (mod m), from the extended GCD. Throws
+  // invalid_argument when gcd(a, m) ≠ 1 or m = 0.
+  BigInteger ModInverse(BigInteger const &a, BigInteger const &m);
+
+  // a^e mod m for m ≠ 0, result in [0, |m|). A negative e inverts a first.
+  // Odd moduli go through MontgomeryContext; even moduli use binary
+  // exponentiation with Barrett reductions.
+  BigInteger ModPow(BigInteger const &a, BigInteger const &exponent, BigInteger const &m);
+}
+
+#endif
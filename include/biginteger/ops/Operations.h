@@ -18,6 +18,16 @@ using namespace std;
 #include "ScalarDivision.h"
 #include "Division.h"
 #include "Shift.h"
+#include "Bitwise.h"
 #include "Comparison.h"
 #include "IO.h"
+#include "Gcd.h"
+#include "Root.h"
+#include "Power.h"
+#include "BinarySplitting.h"
+#include "Combinatorics.h"
+#include "ProductTree.h"
+#include "Primality.h"
+#include "Modular.h"
+#include "Random.h"
 #endif
\ No newline at end of file
@@ -0,0 +1,19 @@
+/**
+ * BigMath: BigInteger integer power.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_POWER
+#define BIGINTEGER_POWER
+
+#include "../BigInteger.h"
+#include "../algorithms/Power.h"
+
+namespace BigMath
+{
+  // a^e; 0^0 = 1. Negative a gives a negative result for odd e.
+  BigInteger Pow(BigInteger const &a, ULong e);
+}
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * BigMath: probable-prime testing (Baillie–PSW).
+ *
+ * IsProbablePrime(n) runs, in order:
+ *
+ *   1. Trial division by the odd primes below BIGMATH_PRIMALITY_TRIAL_BOUND.
+ *      n is reduced once modulo their product (a multi-limb remainder);
+ *      that remainder is then split into one residue per packed 64-bit
+ *      word of primes by single-limb division. Below the square of the
+ *      bound this decides n outright.
+ *   2. A strong Fermat test to base 2 (Miller–Rabin), in the Montgomery
+ *      domain of n.
+ *   3. A strong Lucas test with Selfridge's parameters: the first D in
+ *      5, −7, 9, −11, … with (D/n) = −1, P = 1, Q = (1 − D)/4. The
+ *      sequence is walked as (V_k, V_k+1, Q^k), and U_d ≡ 0 is read off
+ *      as 2·V_d+1 ≡ P·V_d.
+ *
+ * No composite is known to pass both 2 and 3. extraRounds adds strong
+ * Fermat rounds to the next prime bases 3, 5, 7, … on top, up to the
+ * primes below the trial bound.
+ *
+ * The batch overload tests candidates concurrently, one per pool thread
+ * at a time; most composites leave at step 1, so work is handed out
+ * dynamically rather than in fixed ranges.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_PRIMALITY
+#define BIGINTEGER_PRIMALITY
+
+#include <vector>
+
+#include "../BigInteger.h"
+
+#ifndef BIGMATH_PRIMALITY_TRIAL_BOUND
+// Odd primes below this are trial-divided before the BPSW tests.
+#define BIGMATH_PRIMALITY_TRIAL_BOUND 4096
+#endif
+
+namespace BigMath
+{
+  // True for primes and for BPSW pseudoprimes (none known); false for
+  // n < 2, including negative n.
+  bool IsProbablePrime(BigInteger const &n, SizeT extraRounds = 0);
+
+  // IsProbablePrime for every candidate, across the thread pool.
+  vector<bool> IsProbablePrime(vector<BigInteger> const &candidates, SizeT extraRounds = 0);
+}
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * BigMath: product trees, remainder trees and CRT reconstruction.
+ *
+ * A ProductTree over leaves m₀ … m_{k−1} keeps every level of the
+ * pairwise products: level 0 holds the leaves and node i of level j + 1
+ * is the product of nodes 2i and 2i + 1 of level j (an odd last node is
+ * carried up unchanged). The top is M = Πmᵢ. Sibling nodes have about
+ * the same size, so the upper levels are balanced NTT products.
+ *
+ * A RemainderTree adds a CachedDivision (Newton reciprocal) for every node
+ * of at least NEWTON_MEDIUM_B limbs; smaller nodes divide through the
+ * dispatcher, which beats a reciprocal there. Remainders(x) reduces x mod
+ * M once and pushes the remainder down the tree, reducing by each child:
+ * k remainders for O(M(n) log k) instead of k full divisions of x. The
+ * reciprocals are built once, so reducing many integers modulo the same
+ * moduli reuses them. When every modulus fits in a limb, descent stops at
+ * the highest level whose nodes are at most BIGMATH_REMAINDER_BATCH_LIMBS
+ * long, and each node's remainder is reduced by all the moduli below it in
+ * one pass over its limbs.
+ *
+ * FromResidues inverts it for pairwise coprime moduli:
+ *
+ *   x = Σ sᵢ·(M/mᵢ) mod M,   sᵢ = rᵢ·((M/mᵢ) mod mᵢ)⁻¹ mod mᵢ
+ *
+ * The cofactors (M/mᵢ) mod mᵢ come down the tree as (M/N) mod N, which
+ * for a child L with sibling R is ((M/N) mod L)·(R mod L) mod L; the sum
+ * goes back up as v_N = v_L·R + v_R·L.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_PRODUCT_TREE
+#define BIGINTEGER_PRODUCT_TREE
+
+#include <vector>
+
+#include "../BigInteger.h"
+#include "Division.h"
+
+#ifndef BIGMATH_REMAINDER_BATCH_LIMBS
+#define BIGMATH_REMAINDER_BATCH_LIMBS 64
+#endif
+
+namespace BigMath
+{
+  class ProductTree
+  {
+  private:
+    vector<vector<BigInteger>> levels;
+
+  public:
+    // Throws invalid_argument for an empty leaf list.
+    explicit ProductTree(vector<BigInteger> const &leaves);
+
+    // Product of all leaves.
+    BigInteger const &Product() const
+    {
+      return levels.back()[0];
+    }
+
+    // Level 0 is the leaves, Depth() − 1 the product.
+    SizeT Depth() const
+    {
+      return (SizeT)levels.size();
+    }
+
+    vector<BigInteger> const &Level(SizeT j) const
+    {
+      return levels[j];
+    }
+
+    vector<BigInteger> const &Leaves() const
+    {
+      return levels[0];
+    }
+  };
+
+  class RemainderTree
+  {
+  private:
+    ProductTree tree;
+    vector<CachedDivision> dividers;
+    // Index into dividers per node, or −1 for the dispatcher.
+    vector<vector<Int>> divider;
+    // The moduli as limbs when all fit in one, and the level from which
+    // they reduce remainders directly; 0 when the tree is walked to the end.
+    vector<DataT> limbModuli;
+    SizeT batchLevel = 0;
+
+    BigInteger Reduce(BigInteger const &a, SizeT level, SizeT i) const;
+
+  public:
+    // Moduli are taken as magnitudes. Throws invalid_argument for an
+    // empty list or a zero modulus.
+    explicit RemainderTree(vector<BigInteger> const &moduli);
+
+    ProductTree const &Tree() const
+    {
+      return tree;
+    }
+
+    // x mod mᵢ in [0, mᵢ) for every modulus.
+    vector<BigInteger> Remainders(BigInteger const &x) const;
+
+    // The x in [0, Πmᵢ) with x ≡ residues[i] (mod mᵢ). The moduli must
+    // be pairwise coprime; otherwise invalid_argument is thrown.
+    BigInteger FromResidues(vector<BigInteger> const &residues) const;
+  };
+}
+
+#endif
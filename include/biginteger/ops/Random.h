@@ -0,0 +1,42 @@
+/**
+ * BigMath: Uniform random BigIntegers.
+ *
+ * Limbs come straight from RandomGenerator (common/Random.h); no decimal
+ * string is built or parsed.
+ *
+ *   RandomBits(bits, rng)   uniform in [0, 2^bits).
+ *   RandomBelow(bound, rng) uniform in [0, bound), by rejection: the top
+ *                           limb is drawn first and redrawn alone while it
+ *                           exceeds the bound's, so a rejection rarely costs
+ *                           more than one limb. Fewer than two full draws
+ *                           are needed on average.
+ *   RandomBits(bits, seed)  the same as the first, filled in blocks of
+ *                           BIGMATH_RANDOM_BLOCK limbs across the thread
+ *                           pool. Block k uses stream k of the seed, so the
+ *                           value depends only on (bits, seed).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_RANDOM_OPS
+#define BIGINTEGER_RANDOM_OPS
+
+#include "../BigInteger.h"
+#include "../common/Random.h"
+
+#ifndef BIGMATH_RANDOM_BLOCK
+// Limbs per independently seeded block in the parallel RandomBits.
+#define BIGMATH_RANDOM_BLOCK 16384
+#endif
+
+namespace BigMath
+{
+  BigInteger RandomBits(ULong bits, RandomGenerator &rng);
+
+  // Throws invalid_argument unless bound > 0.
+  BigInteger RandomBelow(BigInteger const &bound, RandomGenerator &rng);
+
+  BigInteger RandomBits(ULong bits, ULong seed);
+}
+
+#endif
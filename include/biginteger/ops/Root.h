@@ -0,0 +1,28 @@
+/**
+ * BigMath: BigInteger square root and k-th root.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#ifndef BIGINTEGER_ROOT
+#define BIGINTEGER_ROOT
+
+#include "../BigInteger.h"
+#include "../algorithms/Root.h"
+
+namespace BigMath
+{
+  // ⌊√a⌋. Throws invalid_argument for negative a.
+  BigInteger Sqrt(BigInteger const &a);
+
+  // s = ⌊√a⌋ with remainder = a − s² in [0, 2s].
+  BigInteger SqrtRem(BigInteger const &a, BigInteger &remainder);
+
+  // a^(1/k) rounded toward zero. Negative a needs an odd k.
+  BigInteger Root(BigInteger const &a, SizeT k);
+
+  // x = Root(a, k) with remainder = a − x^k (same sign as a).
+  BigInteger RootRem(BigInteger const &a, SizeT k, BigInteger &remainder);
+}
+
+#endif
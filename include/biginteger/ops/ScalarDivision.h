@@ -7,15 +7,23 @@
 #ifndef BIGINTEGER_SCALAR_DIVISION
 #define BIGINTEGER_SCALAR_DIVISION
 
+#include <span>
 #include <utility>
+#include <vector>
 
 #include "../BigInteger.h"
+#include "../algorithms/Division.h"
 #include "../algorithms/division/ClassicDivision.h"
 
 namespace BigMath
 {
   BigInteger Divide(BigInteger const &a, DataT b);
   std::pair<BigInteger, BigInteger> DivideAndRemainder(BigInteger const &a, DataT b);
+  // a % b in one pass, without a quotient; the sign follows a.
+  BigInteger Remainder(BigInteger const &a, DataT b);
+  bool IsDivisibleBy(BigInteger const &a, DataT b);
+  // a mod d in [0, d) for every divisor, in one pass over a's limbs.
+  std::vector<DataT> RemaindersMod(BigInteger const &a, std::span<const DataT> divisors);
   BigInteger operator/(BigInteger const &a, DataT const &b);
   BigInteger operator%(BigInteger const &a, DataT const &b);
 }
@@ -1,5 +1,10 @@
 /**
- * BigMath: BigInteger bit-shift operators.
+ * BigMath: BigInteger shifts.
+ *
+ * << and >> move whole limbs (a · B^n, a / B^n), as ShiftLeftLimbs and
+ * ShiftRightLimbs do; ShiftLeftBits and ShiftRightBits move bits. All of
+ * them shift the magnitude and keep the sign, so right shifts round
+ * toward zero.
  *
  * S. M. Mahbub Murshed (murshed@gmail.com)
  */
@@ -25,6 +30,30 @@ namespace BigMath
       return a;
     return BigInteger(ShiftRight(a.GetInteger(), b), a.IsNegative());
   }
+
+  inline BigInteger ShiftLeftLimbs(BigInteger const &a, SizeT limbs)
+  {
+    return a << limbs;
+  }
+
+  inline BigInteger ShiftRightLimbs(BigInteger const &a, SizeT limbs)
+  {
+    return a >> limbs;
+  }
+
+  inline BigInteger ShiftLeftBits(BigInteger const &a, ULong bits)
+  {
+    if (bits == 0 || a.Zero())
+      return a;
+    return BigInteger(ShiftLeftBits(a.GetInteger(), bits), a.IsNegative());
+  }
+
+  inline BigInteger ShiftRightBits(BigInteger const &a, ULong bits)
+  {
+    if (bits == 0 || a.Zero())
+      return a;
+    return BigInteger(ShiftRightBits(a.GetInteger(), bits), a.IsNegative());
+  }
 }
 
 #endif
@@ -5,9 +5,72 @@
  */
 
 #include "biginteger/algorithms/BaseConversion.h"
+#include "biginteger/common/Parser.h"
+
+#include <algorithm>
+#include <bit>
 
 namespace BigMath
 {
+  namespace
+  {
+    // log2 of a power-of-two base, 64 for the Base2_64 sentinel, else 0.
+    SizeT BaseBits(BaseT base)
+    {
+      if (base == Base2_64)
+        return 64;
+      return base > 1 && std::has_single_bit((ULong)base) ? (SizeT)std::countr_zero((ULong)base) : 0;
+    }
+
+    // Digits of 2^k1 to digits of 2^k2: the bits only move, so one pass.
+    std::vector<DataT> Repack(std::vector<DataT> const &v, SizeT start, SizeT end, SizeT k1, SizeT k2)
+    {
+      ULong bits = (ULong)(end - start + 1) * k1;
+      std::vector<DataT> out((SizeT)((bits + k2 - 1) / k2) + 1, 0);
+      ULong bit = 0;
+      for (SizeT i = start; i <= end; ++i)
+      {
+        ULong x = v[i];
+        for (SizeT left = k1; left > 0;)
+        {
+          SizeT o = (SizeT)(bit / k2), off = (SizeT)(bit % k2);
+          SizeT take = std::min(k2 - off, left);
+          ULong part = take == 64 ? x : x & ((1ULL << take) - 1);
+          out[o] |= (DataT)(part << off);
+          x = take == 64 ? 0 : x >> take;
+          bit += take;
+          left -= take;
+        }
+      }
+      TrimZerosToOne(out);
+      return out;
+    }
+
+    // Whether base is a radix ParseRadix and ToStringRadix take.
+    bool IsRadix(BaseT base)
+    {
+      return base >= 2 && base <= (BaseT)MaxRadix;
+    }
+
+    DataT DigitOf(char c, SizeT radix)
+    {
+      if (c <= '9')
+        return (DataT)(c - '0');
+      if (c >= 'a')
+        return (DataT)(c - 'a' + (radix <= 36 ? 10 : 36));
+      return (DataT)(c - 'A' + 10);
+    }
+
+    char CharOf(DataT d, SizeT radix)
+    {
+      if (d < 10)
+        return (char)('0' + d);
+      if (radix <= 36 || d < 36)
+        return (char)((radix <= 36 ? 'a' : 'A') + (d - 10));
+      return (char)('a' + (d - 36));
+    }
+  }
+
   std::vector<DataT> ConvertBase(std::vector<DataT> const &bigIntB1,
                                  SizeT start, SizeT end,
                                  BaseT base1,
@@ -16,6 +79,29 @@ namespace BigMath
     if (base1 == base2)
       return std::vector<DataT>(bigIntB1);
 
+    SizeT k1 = BaseBits(base1), k2 = BaseBits(base2);
+    if (k1 != 0 && k2 != 0)
+      return Repack(bigIntB1, start, end, k1, k2);
+
+    // Between the limb base and a radix up to 62, go through the
+    // subquadratic string conversion; its digits are the radix digits.
+    if (base1 == CurrentBase && IsRadix(base2))
+    {
+      std::vector<DataT> limbs(bigIntB1.begin() + start, bigIntB1.begin() + end + 1);
+      std::string s = ToStringRadix(limbs, (SizeT)base2);
+      std::vector<DataT> out(s.size());
+      for (SizeT i = 0; i < s.size(); ++i)
+        out[i] = DigitOf(s[s.size() - 1 - i], (SizeT)base2);
+      return out;
+    }
+    if (IsRadix(base1) && base2 == CurrentBase)
+    {
+      std::string s(end - start + 1, '0');
+      for (SizeT i = start; i <= end; ++i)
+        s[end - i] = CharOf(bigIntB1[i], (SizeT)base1);
+      return ParseUnsignedRadix(s.c_str(), 0, (Int)s.size() - 1, (SizeT)base1);
+    }
+
     std::vector<DataT> bigIntB2(1, 0);
 
     for (Int i = (Int)end; i >= (Int)start; i--)
@@ -0,0 +1,36 @@
+/**
+ * BigMath: combinatorial functions implementation.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <stdexcept>
+
+#include "biginteger/algorithms/Combinatorics.h"
+
+namespace BigMath
+{
+  static void CheckBase(BaseT base)
+  {
+    if (base != CurrentBase)
+      throw std::invalid_argument("Combinatorics requires the binary limb base");
+  }
+
+  std::vector<DataT> Factorial(ULong n, BaseT base)
+  {
+    CheckBase(base);
+    return PrimeSwing::Factorial(n);
+  }
+
+  std::vector<DataT> Binomial(ULong n, ULong k, BaseT base)
+  {
+    CheckBase(base);
+    return PrimeSwing::Binomial(n, k);
+  }
+
+  std::vector<DataT> Primorial(ULong n, BaseT base)
+  {
+    CheckBase(base);
+    return PrimeSwing::Primorial(n);
+  }
+}
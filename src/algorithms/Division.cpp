@@ -6,6 +6,7 @@
 
 #include "biginteger/algorithms/Division.h"
 
+#include <atomic>
 #include <stdexcept>
 
 namespace BigMath
@@ -18,54 +19,94 @@ namespace BigMath
   const SizeT NEWTON_HIGH_SKEW_NUMERATOR = BIGMATH_NEWTON_HIGH_SKEW_NUMERATOR;
   const SizeT NEWTON_HIGH_SKEW_DENOMINATOR = BIGMATH_NEWTON_HIGH_SKEW_DENOMINATOR;
 
+  namespace
+  {
+    std::atomic<DivisionMode> divisionMode{DivisionMode::Throughput};
+    std::atomic<SizeT> divisionWorkers{0};
+
+    SizeT Workers()
+    {
+      if (GetDivisionMode() != DivisionMode::Latency)
+        return 1;
+      SizeT workers = divisionWorkers.load(std::memory_order_relaxed);
+      return workers != 0 ? workers : ParallelNumThreads();
+    }
+
+    std::pair<std::vector<DataT>, std::vector<DataT>> Dispatch(
+        std::vector<DataT> const &a,
+        std::vector<DataT> const &b,
+        BaseT base,
+        bool computeRemainder,
+        bool computeQuotient)
+    {
+      if (IsZero(b))
+        throw std::invalid_argument("Division by zero");
+
+      if (IsZero(a))
+      {
+        auto q = std::vector<DataT>{0};
+        return {q, q};
+      }
+
+      Int cmp = Compare(a, b);
+      if (cmp == 0)
+        return {std::vector<DataT>{1}, std::vector<DataT>{0}};
+      if (cmp < 0)
+        return {std::vector<DataT>{0}, computeRemainder ? a : std::vector<DataT>()};
+
+      // Newton handles any ratio via blockwise mode; pick when divisor is large enough
+      // for reciprocal-setup amortization and skew is in band.
+      bool newton_medium_skew =
+          b.size() >= NEWTON_MEDIUM_B &&
+          NEWTON_SKEW_DENOMINATOR * a.size() >= NEWTON_SKEW_NUMERATOR * b.size();
+      bool newton_high_skew =
+          b.size() >= NEWTON_HIGH_SKEW_B &&
+          NEWTON_HIGH_SKEW_DENOMINATOR * a.size() >= NEWTON_HIGH_SKEW_NUMERATOR * b.size();
+      bool newton_eligible = newton_medium_skew || newton_high_skew;
+      SizeT workers = Workers();
+      if (newton_eligible)
+        return NewtonDivision::DivideAndRemainder(a, b, base, computeRemainder, computeQuotient, workers);
+
+      // BZ for large near-balanced divisors and for big-and-skewed cases.
+      // The +32-limb quotient-bulk guard in the near-balanced clause excludes
+      // degenerate cases where a ≈ b and the quotient is 0-2 limbs — BZ would
+      // split a into m = n/2 blocks and run wasted m×m multiplies on mostly-zero
+      // high blocks, while FastDivision short-circuits via a single qhat
+      // iteration. Regressed 5M×5M balanced 1.45 → 4.48 ms before this guard.
+      bool bz_eligible =
+          (base == Base2_32 || base == Base2_64) &&
+          b.size() > BZ_DIVISOR_THRESHOLD &&
+          ((b.size() >= 1024 && a.size() >= b.size() + 32 && a.size() <= 3 * b.size()) ||
+           (a.size() > 2048 && a.size() > 3 * b.size()));
+      if (bz_eligible)
+        return BurnikelZieglerDivision::DivideAndRemainder(a, b, base, computeRemainder, computeQuotient, workers);
+
+      return FastDivision::DivideAndRemainder(a, b, base, computeRemainder, computeQuotient);
+    }
+  }
+
+  void SetDivisionMode(DivisionMode mode)
+  {
+    divisionMode.store(mode, std::memory_order_relaxed);
+  }
+
+  DivisionMode GetDivisionMode()
+  {
+    return divisionMode.load(std::memory_order_relaxed);
+  }
+
+  void SetDivisionWorkers(SizeT workers)
+  {
+    divisionWorkers.store(workers, std::memory_order_relaxed);
+  }
+
   std::pair<std::vector<DataT>, std::vector<DataT>> DivideAndRemainder(
       std::vector<DataT> const &a,
       std::vector<DataT> const &b,
       BaseT base,
       bool computeRemainder)
   {
-    if (IsZero(b))
-      throw std::invalid_argument("Division by zero");
-
-    if (IsZero(a))
-    {
-      auto q = std::vector<DataT>{0};
-      return {q, q};
-    }
-
-    Int cmp = Compare(a, b);
-    if (cmp == 0)
-      return {std::vector<DataT>{1}, std::vector<DataT>{0}};
-    if (cmp < 0)
-      return {std::vector<DataT>{0}, computeRemainder ? a : std::vector<DataT>()};
-
-    // Newton handles any ratio via blockwise mode; pick when divisor is large enough
-    // for reciprocal-setup amortization and skew is in band.
-    bool newton_medium_skew =
-        b.size() >= NEWTON_MEDIUM_B &&
-        NEWTON_SKEW_DENOMINATOR * a.size() >= NEWTON_SKEW_NUMERATOR * b.size();
-    bool newton_high_skew =
-        b.size() >= NEWTON_HIGH_SKEW_B &&
-        NEWTON_HIGH_SKEW_DENOMINATOR * a.size() >= NEWTON_HIGH_SKEW_NUMERATOR * b.size();
-    bool newton_eligible = newton_medium_skew || newton_high_skew;
-    if (newton_eligible)
-      return NewtonDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-    // BZ for large near-balanced divisors and for big-and-skewed cases.
-    // The +32-limb quotient-bulk guard in the near-balanced clause excludes
-    // degenerate cases where a ≈ b and the quotient is 0-2 limbs — BZ would
-    // split a into m = n/2 blocks and run wasted m×m multiplies on mostly-zero
-    // high blocks, while FastDivision short-circuits via a single qhat
-    // iteration. Regressed 5M×5M balanced 1.45 → 4.48 ms before this guard.
-    bool bz_eligible =
-        (base == Base2_32 || base == Base2_64) &&
-        b.size() > BZ_DIVISOR_THRESHOLD &&
-        ((b.size() >= 1024 && a.size() >= b.size() + 32 && a.size() <= 3 * b.size()) ||
-         (a.size() > 2048 && a.size() > 3 * b.size()));
-    if (bz_eligible)
-      return BurnikelZieglerDivision::DivideAndRemainder(a, b, base, computeRemainder);
-
-    return FastDivision::DivideAndRemainder(a, b, base, computeRemainder);
+    return Dispatch(a, b, base, computeRemainder, true);
   }
 
   std::vector<DataT> Divide(std::vector<DataT> const &a,
@@ -75,6 +116,15 @@ namespace BigMath
     return DivideAndRemainder(a, b, base, false).first;
   }
 
+  std::vector<DataT> Remainder(std::vector<DataT> const &a,
+                               std::vector<DataT> const &b,
+                               BaseT base)
+  {
+    if (b.size() == 1)
+      return std::vector<DataT>{Remainder(a, b[0], base)};
+    return Dispatch(a, b, base, true, false).second;
+  }
+
   std::pair<std::vector<DataT>, std::vector<DataT>> DivideAndRemainder(
       std::vector<DataT> const &a,
       DataT b,
@@ -116,4 +166,114 @@ namespace BigMath
 
     return ClassicDivision::Divide(a, b, base);
   }
+
+  std::vector<DataT> DivExact(std::vector<DataT> const &a,
+                              std::vector<DataT> const &b,
+                              BaseT base)
+  {
+    if (IsZero(b))
+      throw std::invalid_argument("Division by zero");
+
+    if (IsZero(a))
+      return std::vector<DataT>{0};
+
+    // Hensel division needs b odd after removing powers of two.
+    if (base != Base2_32 && base != Base2_64)
+      return Divide(a, b, base);
+
+    return ExactDivision::Divide(a, b);
+  }
+
+  DataT Remainder(std::vector<DataT> const &a,
+                  DataT b,
+                  BaseT base)
+  {
+    if (b == 0)
+      throw std::invalid_argument("Division by zero");
+    return ClassicDivision::Mod(a, b, base);
+  }
+
+  bool IsDivisibleBy(std::vector<DataT> const &a,
+                     std::vector<DataT> const &b,
+                     BaseT base)
+  {
+    if (IsZero(b))
+      throw std::invalid_argument("Division by zero");
+
+    if (IsZero(a))
+      return true;
+
+    if (b.size() == 1)
+      return Remainder(a, b[0], base) == 0;
+
+    if (Compare(a, b) < 0)
+      return false;
+
+    if (base != Base2_32 && base != Base2_64)
+      return IsZero(Remainder(a, b, base));
+
+    // 2-adic: b | a needs 2^v2(b) | a, and then the Hensel quotient, which
+    // agrees with a on its low limbs by construction, must be all of a / b.
+    if (TrailingZeroBits(a) < TrailingZeroBits(b))
+      return false;
+    std::vector<DataT> q = ExactDivision::Divide(a, b);
+    // For a non-multiple q is a random-looking long value, almost never
+    // the length a / b must have.
+    ULong qbBits = BitLength(q) + BitLength(b), aBits = BitLength(a);
+    if (qbBits < aBits || qbBits > aBits + 1)
+      return false;
+    return Compare(Multiply(q, b, base), a) == 0;
+  }
+
+  // (a − q·b) / B^k into [0, b): a − q·b > −b·B^k, so a negative
+  // difference needs one b added back, and a difference of b or more
+  // (a ≥ b·B^k) is reduced by the dispatcher.
+  std::vector<DataT> HenselDivision::Finish(std::vector<DataT> r,
+                                            bool negative,
+                                            std::vector<DataT> const &b)
+  {
+    TrimZerosToOne(r);
+    if (negative)
+    {
+      std::vector<DataT> s = b;
+      SubtractFrom(s, r, CurrentBase);
+      TrimZerosToOne(s);
+      return s;
+    }
+    if (Compare(r, b) >= 0)
+      r = BigMath::Remainder(r, b, CurrentBase);
+    TrimZerosToOne(r);
+    return r;
+  }
+
+  // q = a / b from both ends: limbs [0, h] by Hensel and limbs [h, nq) by
+  // dividing the top of a by the top of b.
+  std::vector<DataT> ExactDivision::Bidirectional(std::vector<DataT> const &a,
+                                                   std::vector<DataT> const &b,
+                                                   SizeT nq)
+  {
+    SizeT nb = (SizeT)b.size();
+    SizeT h = nq / 2;
+    std::vector<DataT> low = HenselDivision::Quotient(a, b, h + 1);
+
+    // With L low limbs dropped from b so that nq − h + 3 remain,
+    // (a >> (L + h) limbs) / (b >> L limbs) is within one of q >> h limbs.
+    SizeT keep = nq - h + 3;
+    SizeT L = nb > keep ? nb - keep : 0;
+    std::vector<DataT> aTop(a.begin() + L + h, a.end()), bTop(b.begin() + L, b.end());
+    std::vector<DataT> high = BigMath::Divide(aTop, bTop, CurrentBase);
+    high.resize(nq - h, 0);
+
+    // Limb h of q is known exactly; it picks high − 1, high or high + 1.
+    DataT diff = (low[h] - high[0]) & LimbMask;
+    if (diff == 1)
+      AddTo(high, (ULong)1, CurrentBase);
+    else if (diff != 0)
+      SubtractFrom(high, (ULong)1, CurrentBase);
+
+    std::vector<DataT> q(low.begin(), low.begin() + h);
+    q.insert(q.end(), high.begin(), high.end());
+    q.resize(nq, 0);
+    return q;
+  }
 }
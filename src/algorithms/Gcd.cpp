@@ -0,0 +1,71 @@
+/**
+ * BigMath: GCD dispatcher implementation.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <stdexcept>
+
+#include "biginteger/algorithms/Gcd.h"
+
+namespace BigMath
+{
+  const SizeT HGCD_THRESHOLD = BIGMATH_HGCD_THRESHOLD;
+  const SizeT GCD_HGCD_THRESHOLD = BIGMATH_GCD_HGCD_THRESHOLD;
+
+  static void CheckBase(BaseT base)
+  {
+    if (base != CurrentBase)
+      throw std::invalid_argument("GCD requires the binary limb base");
+  }
+
+  std::vector<DataT> Gcd(std::vector<DataT> const &a,
+                         std::vector<DataT> const &b,
+                         BaseT base)
+  {
+    CheckBase(base);
+    if (IsZero(a))
+    {
+      std::vector<DataT> r = b;
+      TrimZerosToOne(r);
+      return r;
+    }
+    if (IsZero(b))
+    {
+      std::vector<DataT> r = a;
+      TrimZerosToOne(r);
+      return r;
+    }
+
+    bool swap = Compare(a, b) < 0;
+    std::vector<DataT> const &x = swap ? b : a;
+    std::vector<DataT> const &y = swap ? a : b;
+
+    if (BitLength(y) <= LimbBits)
+    {
+      ULong d = y[0];
+      return std::vector<DataT>{(DataT)LehmerGcd::BinaryGcd(d, LehmerGcd::ModLimb(x, d))};
+    }
+    if (x.size() < GCD_HGCD_THRESHOLD)
+      return LehmerGcd::Gcd(x, y);
+    return HalfGcd::Gcd(x, y);
+  }
+
+  std::vector<DataT> ExtendedGcd(std::vector<DataT> const &a,
+                                 std::vector<DataT> const &b,
+                                 std::vector<DataT> &s,
+                                 std::vector<DataT> &t,
+                                 bool &sNegative,
+                                 BaseT base)
+  {
+    CheckBase(base);
+    if (Compare(a, b) < 0)
+    {
+      // g = s'·b − t'·a (or the reverse): swap roles back.
+      std::vector<DataT> g = HalfGcd::ExtendedGcd(b, a, t, s, sNegative);
+      sNegative = !sNegative;
+      return g;
+    }
+    return HalfGcd::ExtendedGcd(a, b, s, t, sNegative);
+  }
+}
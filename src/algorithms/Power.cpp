@@ -0,0 +1,47 @@
+/**
+ * BigMath: integer power dispatcher implementation.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <limits>
+#include <stdexcept>
+
+#include "biginteger/algorithms/Power.h"
+#include "biginteger/algorithms/Shift.h"
+
+namespace BigMath
+{
+  static void CheckBase(BaseT base)
+  {
+    if (base != CurrentBase)
+      throw std::invalid_argument("Pow requires the binary limb base");
+  }
+
+  std::vector<DataT> Pow(std::vector<DataT> const &a, ULong e, BaseT base)
+  {
+    CheckBase(base);
+    std::vector<DataT> b = a;
+    TrimZerosToOne(b);
+    if (e == 0)
+      return std::vector<DataT>{1};
+    if (IsZero(b))
+      return b;
+
+    // a = 2^t·b with b odd.
+    SizeT zeroLimbs = 0;
+    while (b[zeroLimbs] == 0)
+      ++zeroLimbs;
+    ULong t = (ULong)zeroLimbs * LimbBits + (ULong)__builtin_ctzll((ULong)b[zeroLimbs]);
+    ShiftRightBitsTo(b, t);
+
+    // Result length bound: e·bitlen(a) bits.
+    ULong bits = BitLength(b) + t;
+    if (bits > (ULong)std::numeric_limits<SizeT>::max() * LimbBits / e)
+      throw std::invalid_argument("Exponent too large");
+
+    std::vector<DataT> r = b.size() == 1 && b[0] == 1 ? b : WindowedPower::Pow(b, e);
+    ShiftLeftBitsTo(r, t * e);
+    return r;
+  }
+}
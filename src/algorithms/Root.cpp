@@ -0,0 +1,41 @@
+/**
+ * BigMath: integer root dispatcher implementation.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <stdexcept>
+
+#include "biginteger/algorithms/Root.h"
+
+namespace BigMath
+{
+  static void CheckBase(BaseT base)
+  {
+    if (base != CurrentBase)
+      throw std::invalid_argument("Root requires the binary limb base");
+  }
+
+  std::vector<DataT> SqrtRem(std::vector<DataT> const &a,
+                             std::vector<DataT> &remainder,
+                             BaseT base)
+  {
+    CheckBase(base);
+    auto [s, r] = KaratsubaSquareRoot::SqrtRem(a);
+    remainder = std::move(r);
+    return s;
+  }
+
+  std::vector<DataT> RootRem(std::vector<DataT> const &a,
+                             SizeT k,
+                             std::vector<DataT> &remainder,
+                             BaseT base)
+  {
+    CheckBase(base);
+    if (k == 0)
+      throw std::invalid_argument("Root of degree zero");
+    auto [x, r] = NewtonRoot::RootRem(a, k);
+    remainder = std::move(r);
+    return x;
+  }
+}
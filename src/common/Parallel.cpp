@@ -23,6 +23,12 @@ namespace BigMath
 {
   namespace
   {
+    // Set on pool workers and on a caller while it runs its own chunk. A
+    // dispatch from inside a parallel region (an NTT under a parallel
+    // product-tree subtree, say) runs serially instead of republishing
+    // work to workers that are busy with the outer region.
+    thread_local bool insideParallelRegion = false;
+
     class ThreadPool
     {
     public:
@@ -57,14 +63,16 @@ namespace BigMath
 
       // Dispatch `numChunks` parallel calls of body(start, end). The caller
       // thread runs chunk 0; workers 1..numChunks-1 run the others. Blocks
-      // until all chunks complete.
+      // until all chunks complete. Nested dispatches, and dispatches racing
+      // another thread's, run the whole range serially in the caller.
       void RunChunks(Int numChunks, Int total, void (*body)(Int, Int, void *), void *ctx)
       {
-        if (numChunks <= 1)
+        if (numChunks <= 1 || insideParallelRegion || !dispatch.try_lock())
         {
           body(0, total, ctx);
           return;
         }
+        std::lock_guard<std::mutex> owner(dispatch, std::adopt_lock);
         if ((SizeT)numChunks > numThreads) numChunks = (Int)numThreads;
 
         // Publish work.
@@ -79,20 +87,28 @@ namespace BigMath
         }
         cv.notify_all();
 
-        // Caller runs chunk 0 itself.
-        Int chunkSize = (total + numChunks - 1) / numChunks;
-        Int s0 = 0;
-        Int e0 = std::min(total, chunkSize);
-        body(s0, e0, ctx);
+        // Caller runs chunk 0 itself. If it throws, the guard still clears
+        // the region flag and waits for the workers, which hold ctx.
+        struct RegionGuard
+        {
+          ThreadPool &pool;
+          explicit RegionGuard(ThreadPool &p) : pool(p) { insideParallelRegion = true; }
+          ~RegionGuard()
+          {
+            insideParallelRegion = false;
+            std::unique_lock<std::mutex> lk(pool.m);
+            pool.doneCv.wait(lk, [this] { return pool.remaining == 0; });
+          }
+        } guard(*this);
 
-        // Wait for workers.
-        std::unique_lock<std::mutex> lk(m);
-        doneCv.wait(lk, [this] { return remaining == 0; });
+        Int chunkSize = (total + numChunks - 1) / numChunks;
+        body(0, std::min(total, chunkSize), ctx);
       }
 
     private:
       void WorkerLoop(Int workerId)
       {
+        insideParallelRegion = true;
         Long lastSeen = 0;
         for (;;)
         {
@@ -131,6 +147,7 @@ namespace BigMath
 
       SizeT numThreads = 1;
       std::vector<std::thread> workers;
+      std::mutex dispatch;
       std::mutex m;
       std::condition_variable cv;
       std::condition_variable doneCv;
@@ -1,5 +1,5 @@
 /**
- * BigMath: Decimal parsing and formatting implementation.
+ * BigMath: Decimal and any-radix parsing and formatting implementation.
  *
  * Architectural overview: STRING_CONVERSION.md.
  *
@@ -10,18 +10,210 @@
 #include "biginteger/BigInteger.h"
 #include "biginteger/algorithms/Addition.h"
 #include "biginteger/algorithms/Multiplication.h"
+#include "biginteger/algorithms/Shift.h"
 #include "biginteger/algorithms/Squaring.h"
 #include "biginteger/algorithms/multiplication/ClassicMultiplication.h"
 #include "biginteger/algorithms/division/ClassicDivision.h"
+#include "biginteger/algorithms/division/ConstantDivision.h"
 #include "biginteger/algorithms/division/NewtonDivision.h"
 
+#if BIGMATH_PARSE_SIMD && (defined(__SSE2__) || defined(__AVX2__))
+#include <immintrin.h>
+#endif
+
+#include <bit>
+#include <cstring>
 #include <memory>
 #include <cmath>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 
 namespace BigMath
 {
+  namespace
+  {
+    // Digit characters up to radix 36, and from 37 to 62.
+    constexpr char RadixDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    constexpr char RadixDigits62[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+    // Digit value of c, or 255 for a character that is no digit.
+    struct DigitTable
+    {
+      unsigned char value[256];
+
+      constexpr explicit DigitTable(char const *alphabet, bool caseSensitive) : value{}
+      {
+        for (int c = 0; c < 256; ++c)
+          value[c] = 255;
+        for (int d = 0; alphabet[d] != 0; ++d)
+        {
+          char c = alphabet[d];
+          value[(unsigned char)c] = (unsigned char)d;
+          if (!caseSensitive && c >= 'a' && c <= 'z')
+            value[(unsigned char)(c - 'a' + 'A')] = (unsigned char)d;
+        }
+      }
+    };
+    constexpr DigitTable Digits{RadixDigits, false};
+    constexpr DigitTable Digits62{RadixDigits62, true};
+
+    inline unsigned DigitValue(char c, SizeT radix)
+    {
+      return (radix <= 36 ? Digits : Digits62).value[(unsigned char)c];
+    }
+
+    // The largest radix^k that fits a chunk. Parsing keeps chunks ≤ 2^60 as
+    // with 10^18; formatting divides by the largest power below 2^64 as
+    // with 10^19.
+    struct RadixChunk
+    {
+      SizeT parseDigits;
+      ULong parsePower;
+      SizeT formatDigits;
+      ULong formatPower;
+    };
+
+    struct RadixChunkTable
+    {
+      RadixChunk chunk[MaxRadix + 1];
+
+      constexpr RadixChunkTable() : chunk{}
+      {
+        for (ULong radix = 2; radix <= MaxRadix; ++radix)
+        {
+          RadixChunk &c = chunk[radix];
+          c.parsePower = c.formatPower = 1;
+          while (c.parsePower <= (1ULL << 60) / radix)
+            c.parsePower *= radix, ++c.parseDigits;
+          while (c.formatPower <= ~0ULL / radix)
+            c.formatPower *= radix, ++c.formatDigits;
+        }
+      }
+    };
+    constexpr RadixChunkTable Chunks;
+
+    void CheckRadix(SizeT radix)
+    {
+      if (radix < 2 || radix > MaxRadix)
+        throw std::invalid_argument("Radix must be from 2 to 62");
+    }
+
+    constexpr bool LittleEndian = std::endian::native == std::endian::little;
+
+    inline ULong Load8(char const *p)
+    {
+      ULong v;
+      std::memcpy(&v, p, 8);
+      return v;
+    }
+
+    // Digit scans look for the terminator this many bytes at a time, so a
+    // short number at the front of a long buffer is not followed to its end.
+    constexpr SizeT ScanWindow = 4096;
+
+    // First index at or after pos that is no digit. On little-endian hosts
+    // skip(num, pos, limit) first passes whole blocks of digits below limit,
+    // then the rest goes a character at a time.
+    template <class Skip, class IsDigit>
+    Int ScanDigits(char const *num, Int pos, Skip skip, IsDigit isDigit)
+    {
+      if constexpr (LittleEndian)
+      {
+        for (;;)
+        {
+          void const *nul = std::memchr(num + pos, 0, ScanWindow);
+          Int limit = nul != nullptr ? (Int)((char const *)nul - num) : pos + (Int)ScanWindow;
+          pos = skip(num, pos, limit);
+          if (nul != nullptr || pos + 8 <= limit)
+            break;
+        }
+      }
+      while (isDigit(num[pos]))
+        ++pos;
+      return pos;
+    }
+
+    inline bool IsDecimal(char c)
+    {
+      return c >= '0' && c <= '9';
+    }
+
+    // Eight decimal digits, first digit in the low byte, to their value:
+    // neighbouring digits pair up, then pairs of pairs in two multiplies
+    // (Lemire's SWAR method).
+    inline ULong Parse8Digits(ULong v)
+    {
+      v -= 0x3030303030303030ULL;
+      v = v * 10 + (v >> 8);
+      return (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+              (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    }
+
+    inline bool AllDecimal8(ULong v)
+    {
+      return (v & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL &&
+             ((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL;
+    }
+
+#if BIGMATH_PARSE_SIMD && defined(__SSE4_1__)
+    // Sixteen digits: subtract '0', then pmaddubsw folds digit pairs,
+    // pmaddwd pairs of pairs, and after packing to 16 bits a second pmaddwd
+    // leaves the two eight-digit halves.
+    inline ULong Parse16Digits(char const *p)
+    {
+      __m128i v = _mm_sub_epi8(_mm_loadu_si128((__m128i const *)p), _mm_set1_epi8('0'));
+      v = _mm_maddubs_epi16(v, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+      v = _mm_madd_epi16(v, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+      v = _mm_packus_epi32(v, v);
+      v = _mm_madd_epi16(v, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+      return (ULong)(unsigned)_mm_cvtsi128_si32(v) * 100000000 + (unsigned)_mm_extract_epi32(v, 1);
+    }
+#endif
+
+#if BIGMATH_PARSE_SIMD && defined(__SSE2__)
+    // Bytes minus '0' are digits exactly when they are at most 9 unsigned.
+    inline bool AllDecimal16(char const *p)
+    {
+      __m128i t = _mm_sub_epi8(_mm_loadu_si128((__m128i const *)p), _mm_set1_epi8('0'));
+      __m128i nine = _mm_set1_epi8(9);
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(t, nine), nine)) == 0xFFFF;
+    }
+#endif
+
+#if BIGMATH_PARSE_SIMD && defined(__AVX2__)
+    inline bool AllDecimal32(char const *p)
+    {
+      __m256i t = _mm256_sub_epi8(_mm256_loadu_si256((__m256i const *)p), _mm256_set1_epi8('0'));
+      __m256i nine = _mm256_set1_epi8(9);
+      return _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(t, nine), nine)) == -1;
+    }
+#endif
+
+    inline Int SkipDecimalBlocks(char const *num, Int pos, Int limit)
+    {
+#if BIGMATH_PARSE_SIMD && defined(__AVX2__)
+      while (pos + 32 <= limit && AllDecimal32(num + pos))
+        pos += 32;
+#endif
+#if BIGMATH_PARSE_SIMD && defined(__SSE2__)
+      while (pos + 16 <= limit && AllDecimal16(num + pos))
+        pos += 16;
+#endif
+      while (pos + 8 <= limit && AllDecimal8(Load8(num + pos)))
+        pos += 8;
+      return pos;
+    }
+
+    // A decimal digit count scaled to the same bit length in radix.
+    SizeT ScaleDigits(SizeT decimalDigits, SizeT radix)
+    {
+      if (radix == 10)
+        return decimalDigits;
+      return (SizeT)std::ceil(decimalDigits * std::log2(10.0) / std::log2((double)radix));
+    }
+  }
+
   Int FindRange(char const *num, Int &start, Int &end, bool &isNegative)
   {
     Int char_processed = start;
@@ -40,9 +232,13 @@ namespace BigMath
     while (num[start] == '0')
       start++;
 
+#if BIGMATH_PARSE_SIMD
+    end = ScanDigits(num, start, SkipDecimalBlocks, IsDecimal);
+#else
     end = start;
-    while (num[end] >= '0' && num[end] <= '9')
+    while (IsDecimal(num[end]))
       end++;
+#endif
 
     char_processed = end - char_processed;
     end--;
@@ -50,11 +246,30 @@ namespace BigMath
     return char_processed;
   }
 
+  // The leading len % 8 digits one at a time, then 16 (SSE4.1) or eight
+  // (SWAR) per step.
   ULong ParseChunk(char const *num, Int start, SizeT len)
   {
+    char const *p = num + start;
     ULong chunk = 0;
+    if (BIGMATH_PARSE_SIMD && LittleEndian)
+    {
+      for (; len % 8 != 0; --len)
+        chunk = chunk * 10 + (ULong)(*p++ - '0');
+#if BIGMATH_PARSE_SIMD && defined(__SSE4_1__)
+      if (len >= 16)
+      {
+        chunk = chunk * 10000000000000000ULL + Parse16Digits(p);
+        p += 16;
+        len -= 16;
+      }
+#endif
+      for (; len > 0; len -= 8, p += 8)
+        chunk = chunk * 100000000 + Parse8Digits(Load8(p));
+      return chunk;
+    }
     for (SizeT i = 0; i < len; ++i)
-      chunk = chunk * 10 + (ULong)(num[start + (Int)i] - '0');
+      chunk = chunk * 10 + (ULong)(p[i] - '0');
     return chunk;
   }
 
@@ -109,12 +324,15 @@ namespace BigMath
 
   // Memoized recursive doubling. thread_local cache lives in this TU only — every
   // consumer that includes Parser.h shares the same cache per-thread (a real
-  // benefit of the .cpp split over the prior header-only design).
-  std::vector<DataT> Pow10(SizeT digits)
+  // benefit of the .cpp split over the prior header-only design). One map
+  // holds every radix, keyed by (radix, digits).
+  std::vector<DataT> RadixPower(SizeT radix, SizeT digits)
   {
-    static thread_local std::unordered_map<SizeT, std::vector<DataT>> cache;
+    CheckRadix(radix);
+    static thread_local std::unordered_map<ULong, std::vector<DataT>> cache;
 
-    auto it = cache.find(digits);
+    ULong key = ((ULong)radix << 32) | digits;
+    auto it = cache.find(key);
     if (it != cache.end())
       return it->second;
 
@@ -123,28 +341,33 @@ namespace BigMath
     {
       value = std::vector<DataT>{1};
     }
-    else if (digits <= Base10_18_Zeroes)
+    else if (digits <= Chunks.chunk[radix].parseDigits)
     {
       ULong p = 1;
       for (SizeT i = 0; i < digits; ++i)
-        p *= 10;
+        p *= radix;
       value = Convert(p);
     }
     else if (digits % 2 == 0)
     {
-      // Pow10(d) = Pow10(d/2)². One Square (single FFT in NTT) instead of
+      // r^d = (r^(d/2))². One Square (single FFT in NTT) instead of
       // Multiply(p, p) (two FFTs).
-      std::vector<DataT> p = Pow10(digits / 2);
+      std::vector<DataT> p = RadixPower(radix, digits / 2);
       value = Square(p, CurrentBase);
     }
     else
     {
       SizeT lo = digits / 2;
       SizeT hi = digits - lo;
-      value = Multiply(Pow10(hi), Pow10(lo), CurrentBase);
+      value = Multiply(RadixPower(radix, hi), RadixPower(radix, lo), CurrentBase);
     }
 
-    return cache.emplace(digits, value).first->second;
+    return cache.emplace(key, value).first->second;
+  }
+
+  std::vector<DataT> Pow10(SizeT digits)
+  {
+    return RadixPower(10, digits);
   }
 
   std::vector<DataT> ParseUnsignedDivideConquer(char const *num, Int start, Int end)
@@ -196,6 +419,258 @@ namespace BigMath
     return Parse(num, 0, char_processed);
   }
 
+  // ─── power-of-two radixes ───────────────────────────────────────────────────
+
+  namespace
+  {
+    // Eight hex digits, first digit in the low byte, to their 32-bit value.
+    // Each byte becomes its nibble ('a' and 'A' have bit 6 set and low
+    // nibble one less than their value − 9), then the nibbles pair up into
+    // bytes, bytes into halfwords and halfwords into the word.
+    inline ULong PackHex8(ULong v)
+    {
+      v = (v & 0x0F0F0F0F0F0F0F0FULL) + 9 * ((v >> 6) & 0x0101010101010101ULL);
+      v = ((v & 0x000F000F000F000FULL) << 4) | ((v >> 8) & 0x000F000F000F000FULL);
+      v = ((v & 0x000000FF000000FFULL) << 8) | ((v >> 16) & 0x000000FF000000FFULL);
+      return ((v & 0xFFFF) << 16) | ((v >> 32) & 0xFFFF);
+    }
+
+    // Eight binary digits, first digit in the low byte, to their byte: the
+    // multiply moves byte i's bit to bit 63 − i without carries.
+    inline ULong PackBinary8(ULong v)
+    {
+      return ((v & 0x0101010101010101ULL) * 0x8040201008040201ULL) >> 56;
+    }
+
+    // Bytes of v strictly between lo and hi get 0x80; v's bytes are < 0x80.
+    inline ULong BytesBetween(ULong v, ULong lo, ULong hi)
+    {
+      constexpr ULong ones = 0x0101010101010101ULL;
+      return (ones * (127 + hi) - v) & ~v & (v + ones * (127 - lo)) & (ones * 128);
+    }
+
+    // Whether all eight bytes of v are binary or hex digits.
+    inline bool AllDigits8(ULong v, SizeT radix)
+    {
+      constexpr ULong high = 0x8080808080808080ULL;
+      if (radix == 2)
+        return (v & 0xFEFEFEFEFEFEFEFEULL) == 0x3030303030303030ULL;
+      if (v & high)
+        return false;
+      return (BytesBetween(v, '0' - 1, '9' + 1) | BytesBetween(v | 0x2020202020202020ULL, 'a' - 1, 'f' + 1)) == high;
+    }
+
+    // The inverse of PackHex8: w's eight nibbles, most significant first, as
+    // ASCII in the eight bytes of the result, first digit in the low byte.
+    inline ULong UnpackHex8(ULong w)
+    {
+      ULong v = (w >> 16) | ((w & 0xFFFF) << 32);
+      v = ((v >> 8) & 0x000000FF000000FFULL) | ((v & 0x000000FF000000FFULL) << 16);
+      v = ((v >> 4) & 0x000F000F000F000FULL) | ((v & 0x000F000F000F000FULL) << 8);
+      ULong letters = ((v + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL;
+      return v + 0x3030303030303030ULL + letters * ('a' - '0' - 10);
+    }
+
+    // The inverse of PackBinary8 for one byte.
+    inline ULong UnpackBinary8(ULong b)
+    {
+      ULong v = (b * 0x0101010101010101ULL) & 0x0102040810204080ULL;
+      v = ((v + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+      return v + 0x3030303030303030ULL;
+    }
+
+    // The 32-bit word at bit offset 32·i of the value.
+    inline ULong Word32(std::vector<DataT> const &v, SizeT i)
+    {
+      if constexpr (LimbBits == 64)
+        return (v[i / 2] >> (32 * (i % 2))) & 0xFFFFFFFFULL;
+      else
+        return v[i];
+    }
+
+    inline void SetWord32(std::vector<DataT> &v, SizeT i, ULong w)
+    {
+      if constexpr (LimbBits == 64)
+        v[i / 2] |= (DataT)w << (32 * (i % 2));
+      else
+        v[i] = (DataT)w;
+    }
+
+    // Bits [bit, bit + k) of the value, k ≤ 8.
+    inline unsigned BitsAt(std::vector<DataT> const &v, ULong bit, SizeT k)
+    {
+      SizeT limb = (SizeT)(bit / LimbBits), off = (SizeT)(bit % LimbBits);
+      ULong x = v[limb] >> off;
+      if (off + k > LimbBits && limb + 1 < v.size())
+        x |= v[limb + 1] << (LimbBits - off);
+      return (unsigned)(x & ((1u << k) - 1));
+    }
+  }
+
+  SizeT RadixBits(SizeT radix)
+  {
+    if (radix < 2 || radix > 32 || !std::has_single_bit(radix))
+      throw std::invalid_argument("Radix must be a power of two from 2 to 32");
+    return (SizeT)std::countr_zero(radix);
+  }
+
+  std::vector<DataT> ParseUnsignedPow2(char const *num, Int start, Int end, SizeT radix)
+  {
+    SizeT k = RadixBits(radix);
+    if (start > end)
+      return std::vector<DataT>{0};
+
+    SizeT digits = (SizeT)(end - start + 1);
+    ULong bits = (ULong)digits * k;
+    std::vector<DataT> r((SizeT)((bits + 31) / 32 * 32 / LimbBits) + 1, 0);
+    Int pos = end + 1;
+
+    // Whole 32-bit words from the low end, eight or 32 digits at a time.
+    SizeT words = 0;
+    if (LittleEndian && (k == 4 || k == 1))
+    {
+      SizeT per = k == 4 ? 8 : 32;
+      for (; (SizeT)(pos - start) >= per; ++words)
+      {
+        pos -= (Int)per;
+        char const *p = num + pos;
+        ULong w = 0;
+        if (k == 4)
+          w = PackHex8(Load8(p));
+        else
+          for (SizeT j = 0; j < 4; ++j)
+            w = (w << 8) | PackBinary8(Load8(p + 8 * j) - 0x3030303030303030ULL);
+        SetWord32(r, words, w);
+      }
+    }
+
+    // The rest a digit at a time.
+    ULong bit = (ULong)words * 32;
+    while (pos > start)
+    {
+      ULong d = Digits.value[(unsigned char)num[--pos]];
+      SizeT limb = (SizeT)(bit / LimbBits), off = (SizeT)(bit % LimbBits);
+      r[limb] |= (d << off) & LimbMask;
+      if (off + k > LimbBits)
+        r[limb + 1] |= d >> (LimbBits - off);
+      bit += k;
+    }
+
+    TrimZerosToOne(r);
+    return r;
+  }
+
+  BigInteger ParseRadixPow2(char const *num, SizeT radix, Int *char_processed)
+  {
+    RadixBits(radix);
+    if (num == nullptr)
+      return BigInteger();
+
+    Int start = 0;
+    bool isNegative = false;
+    if (num[0] == '-' || num[0] == '+')
+    {
+      isNegative = num[0] == '-';
+      start = 1;
+    }
+    while (num[start] == '0')
+      ++start;
+    auto skip = [radix](char const *text, Int pos, Int limit)
+    {
+      if (radix == 16 || radix == 2)
+        while (pos + 8 <= limit && AllDigits8(Load8(text + pos), radix))
+          pos += 8;
+      return pos;
+    };
+    Int end = ScanDigits(num, start, skip, [radix](char c) { return Digits.value[(unsigned char)c] < radix; });
+    if (char_processed != nullptr)
+      *char_processed = end;
+
+    if (start == end)
+      return BigInteger();
+    return BigInteger(ParseUnsignedPow2(num, start, end - 1, radix), isNegative);
+  }
+
+  BigInteger ParseHex(char const *num, Int *char_processed)
+  {
+    return ParseRadixPow2(num, 16, char_processed);
+  }
+
+  BigInteger ParseBinary(char const *num, Int *char_processed)
+  {
+    return ParseRadixPow2(num, 2, char_processed);
+  }
+
+  std::string ToStringPow2(std::vector<DataT> const &bigInt, SizeT radix, bool isNeg)
+  {
+    SizeT k = RadixBits(radix);
+    ULong bits = BitLength(bigInt);
+    if (bits == 0)
+      return std::string("0");
+
+    SizeT digits = (SizeT)((bits + k - 1) / k);
+    std::string s(digits + (isNeg ? 1 : 0), '0');
+    char *out = s.data() + (isNeg ? 1 : 0);
+    if (isNeg)
+      s[0] = '-';
+
+    // Whole 32-bit words from the low end into the tail of the string.
+    SizeT pos = digits, words = 0;
+    if (LittleEndian && (k == 4 || k == 1))
+    {
+      SizeT per = k == 4 ? 8 : 32;
+      for (; pos >= per; ++words)
+      {
+        pos -= per;
+        ULong w = Word32(bigInt, words);
+        if (k == 4)
+        {
+          ULong c = UnpackHex8(w);
+          std::memcpy(out + pos, &c, 8);
+        }
+        else
+          for (SizeT j = 0; j < 4; ++j)
+          {
+            ULong c = UnpackBinary8((w >> (24 - 8 * j)) & 0xFF);
+            std::memcpy(out + pos + 8 * j, &c, 8);
+          }
+      }
+    }
+
+    ULong bit = (ULong)words * 32;
+    while (pos > 0)
+    {
+      out[--pos] = RadixDigits[BitsAt(bigInt, bit, k)];
+      bit += k;
+    }
+    return s;
+  }
+
+  std::string ToStringPow2(BigInteger const &bigInt, SizeT radix)
+  {
+    return ToStringPow2(bigInt.GetInteger(), radix, bigInt.IsNegative());
+  }
+
+  std::string ToHex(std::vector<DataT> const &bigInt, bool isNeg)
+  {
+    return ToStringPow2(bigInt, 16, isNeg);
+  }
+
+  std::string ToHex(BigInteger const &bigInt)
+  {
+    return ToHex(bigInt.GetInteger(), bigInt.IsNegative());
+  }
+
+  std::string ToBinary(std::vector<DataT> const &bigInt, bool isNeg)
+  {
+    return ToStringPow2(bigInt, 2, isNeg);
+  }
+
+  std::string ToBinary(BigInteger const &bigInt)
+  {
+    return ToBinary(bigInt.GetInteger(), bigInt.IsNegative());
+  }
+
   namespace
   {
     constexpr char DigitPairs[] =
@@ -274,7 +749,7 @@ namespace BigMath
     std::vector<ULong> chunks;
     chunks.reserve(r.size() + 1);
     while (!(r.size() == 1 && r[0] == 0))
-      chunks.push_back((ULong)ClassicDivision::DivModTo(r, Base10_19, CurrentBase));
+      chunks.push_back(ConstantDivider<Base10_19>::DivModTo(r));
 
     int topDigits = 0;
     {
@@ -295,11 +770,68 @@ namespace BigMath
       AppendPaddedUnsignedDecimal(*it, Base10_19_Zeroes, out);
   }
 
-  // Chain entry: 10^digits + its precomputed Newton-reciprocal divider.
+  // Chain entry: radix^digits + its precomputed Newton-reciprocal divider.
   // Built top-down so each level splits its parent in half — balanced T(N) = 2T(N/2) + M(N).
   namespace
   {
-    SizeT EstimateDecimalDigits(std::vector<DataT> const &r)
+    // Linear leaf for radixes other than 10: divmod by the largest radix^k
+    // below 2^64, then k digits per chunk.
+    void ToStringRadixLinearAppend(std::vector<DataT> r, SizeT radix, SizeT padTo, std::string &out)
+    {
+      if (IsZero(r))
+      {
+        if (padTo == 0)
+          out.push_back('0');
+        else
+          out.append(padTo, '0');
+        return;
+      }
+
+      while (r.size() > 1 && r.back() == 0)
+        r.pop_back();
+
+      RadixChunk const &chunk = Chunks.chunk[radix];
+      ClassicDivision::GranlundMollerDivider gm(chunk.formatPower);
+      std::vector<ULong> chunks;
+      chunks.reserve(r.size() + 1);
+      while (!(r.size() == 1 && r[0] == 0))
+      {
+        ULong rem = 0;
+        for (SizeT i = (SizeT)r.size(); i-- > 0;)
+        {
+          if constexpr (LimbBits == 64)
+            r[i] = (DataT)gm.DivMod(rem, r[i], rem);
+          else
+          {
+            ULong128 acc = ((ULong128)rem << 32) | r[i];
+            r[i] = (DataT)gm.DivMod((ULong)(acc >> 64), (ULong)acc, rem);
+          }
+        }
+        while (r.size() > 1 && r.back() == 0)
+          r.pop_back();
+        chunks.push_back(rem);
+      }
+
+      char const *alphabet = radix <= 36 ? RadixDigits : RadixDigits62;
+      char buf[64];
+      SizeT topDigits = 0;
+      for (ULong v = chunks.back(); v != 0; v /= radix)
+        ++topDigits;
+      SizeT natural = (SizeT)(chunks.size() - 1) * chunk.formatDigits + topDigits;
+      if (padTo > natural)
+        out.append(padTo - natural, '0');
+
+      for (SizeT i = (SizeT)chunks.size(); i-- > 0;)
+      {
+        SizeT width = i + 1 == chunks.size() ? topDigits : chunk.formatDigits;
+        ULong v = chunks[i];
+        for (SizeT j = width; j-- > 0; v /= radix)
+          buf[j] = alphabet[v % radix];
+        out.append(buf, width);
+      }
+    }
+
+    SizeT EstimateDigits(std::vector<DataT> const &r, SizeT radix)
     {
 #if BIGMATH_LIMB_64
       constexpr SizeT limbBits = 64;
@@ -309,44 +841,49 @@ namespace BigMath
       SizeT highBits = limbBits - (SizeT)__builtin_clz((unsigned)r.back());
 #endif
       long double bits = (long double)(r.size() - 1) * (long double)limbBits + (long double)highBits;
-      return (SizeT)std::floor(bits * 0.3010299956639811952137388947244930267682L) + 1;
+      long double digitsPerBit = radix == 10 ? 0.3010299956639811952137388947244930267682L
+                                             : 1.0L / std::log2((long double)radix);
+      return (SizeT)std::floor(bits * digitsPerBit) + 1;
     }
 
-    struct DecimalDcEntry
+    struct RadixDcEntry
     {
       SizeT digits;
       std::vector<DataT> value;
       std::shared_ptr<NewtonDivision::Divider> divider;
     };
 
-    std::vector<DecimalDcEntry> BuildDecimalDcChain(SizeT topDigits)
+    std::vector<RadixDcEntry> BuildRadixDcChain(SizeT radix, SizeT topDigits)
     {
-      std::vector<DecimalDcEntry> chain;
-      for (SizeT d = topDigits; d >= ToStringDcThreshold / 2; d /= 2)
+      std::vector<RadixDcEntry> chain;
+      SizeT minDigits = ScaleDigits(ToStringDcThreshold, radix) / 2;
+      for (SizeT d = topDigits; d >= minDigits; d /= 2)
       {
-        DecimalDcEntry e;
+        RadixDcEntry e;
         e.digits = d;
-        e.value = Pow10(d);
+        e.value = RadixPower(radix, d);
         e.divider = std::make_shared<NewtonDivision::Divider>(e.value, CurrentBase);
         chain.push_back(std::move(e));
       }
       return chain;
     }
 
-    std::vector<DecimalDcEntry> const &GetDecimalDcChain(SizeT topDigits)
+    std::vector<RadixDcEntry> const &GetRadixDcChain(SizeT radix, SizeT topDigits)
     {
-      static thread_local std::unordered_map<SizeT, std::vector<DecimalDcEntry>> cache;
-      auto it = cache.find(topDigits);
+      static thread_local std::unordered_map<ULong, std::vector<RadixDcEntry>> cache;
+      ULong key = ((ULong)radix << 32) | topDigits;
+      auto it = cache.find(key);
       if (it != cache.end())
         return it->second;
 
-      auto inserted = cache.emplace(topDigits, BuildDecimalDcChain(topDigits));
+      auto inserted = cache.emplace(key, BuildRadixDcChain(radix, topDigits));
       return inserted.first->second;
     }
 
     void ToStringDivConquer(
         std::vector<DataT> n,
-        std::vector<DecimalDcEntry> const &chain,
+        std::vector<RadixDcEntry> const &chain,
+        SizeT radix,
         SizeT level,
         SizeT padTo,
         std::string &out)
@@ -362,14 +899,17 @@ namespace BigMath
 
       if (level >= chain.size())
       {
-        ToStringLinearAppend(std::move(n), padTo, out);
+        if (radix == 10)
+          ToStringLinearAppend(std::move(n), padTo, out);
+        else
+          ToStringRadixLinearAppend(std::move(n), radix, padTo, out);
         return;
       }
 
       // n smaller than this level's divisor → top half empty; descend.
       if (Compare(n, chain[level].value) < 0)
       {
-        ToStringDivConquer(std::move(n), chain, level + 1, padTo, out);
+        ToStringDivConquer(std::move(n), chain, radix, level + 1, padTo, out);
         return;
       }
 
@@ -378,8 +918,8 @@ namespace BigMath
       chain[level].divider->DivideAndRemainderInto(n, q, r);
       SizeT half = chain[level].digits;
       SizeT topPad = (padTo > half) ? padTo - half : 0;
-      ToStringDivConquer(std::move(q), chain, level + 1, topPad, out);
-      ToStringDivConquer(std::move(r), chain, level + 1, half, out);
+      ToStringDivConquer(std::move(q), chain, radix, level + 1, topPad, out);
+      ToStringDivConquer(std::move(r), chain, radix, level + 1, half, out);
     }
   } // namespace
 
@@ -392,7 +932,7 @@ namespace BigMath
     while (r.size() > 1 && r.back() == 0)
       r.pop_back();
 
-    SizeT approxDigits = EstimateDecimalDigits(r);
+    SizeT approxDigits = EstimateDigits(r, 10);
 
     std::string s;
     s.reserve(approxDigits + (isNeg ? 2 : 1));
@@ -405,8 +945,8 @@ namespace BigMath
       return s;
     }
 
-    auto const &chain = GetDecimalDcChain(approxDigits / 2);
-    ToStringDivConquer(std::move(r), chain, 0, 0, s);
+    auto const &chain = GetRadixDcChain(10, approxDigits / 2);
+    ToStringDivConquer(std::move(r), chain, 10, 0, 0, s);
     return s;
   }
 
@@ -419,4 +959,140 @@ namespace BigMath
   {
     return ToString(bigInt.GetInteger(), bigInt.IsNegative());
   }
+
+  // ─── any radix ──────────────────────────────────────────────────────────────
+
+  namespace
+  {
+    ULong ParseRadixChunk(char const *num, Int start, SizeT len, SizeT radix)
+    {
+      ULong chunk = 0;
+      for (SizeT i = 0; i < len; ++i)
+        chunk = chunk * radix + DigitValue(num[start + (Int)i], radix);
+      return chunk;
+    }
+
+    // ParseUnsignedLinear with radix^k chunks.
+    std::vector<DataT> ParseUnsignedRadixLinear(char const *num, Int start, Int end, SizeT radix)
+    {
+      RadixChunk const &c = Chunks.chunk[radix];
+      SizeT len = (SizeT)(end - start + 1);
+      std::vector<DataT> r;
+      r.reserve((SizeT)(len * std::log2((double)radix) / LimbBits) + 2);
+      r.push_back(0);
+
+      SizeT remainder = len % c.parseDigits;
+      Int pos = start;
+      if (remainder > 0)
+      {
+        AddTo(r, ParseRadixChunk(num, pos, remainder, radix), CurrentBase);
+        pos += (Int)remainder;
+      }
+
+      while (pos <= end)
+      {
+        ULong chunk = ParseRadixChunk(num, pos, c.parseDigits, radix);
+        pos += (Int)c.parseDigits;
+        ClassicMultiplication::MultiplyTo(r, c.parsePower, CurrentBase);
+        AddTo(r, chunk, CurrentBase);
+      }
+      return r;
+    }
+
+    std::vector<DataT> ParseUnsignedRadixDivideConquer(
+        char const *num, Int start, Int end, SizeT radix, SizeT threshold)
+    {
+      SizeT len = (SizeT)(end - start + 1);
+      if (len <= threshold)
+        return ParseUnsignedRadixLinear(num, start, end, radix);
+
+      SizeT lowDigits = len / 2;
+      Int split = end - (Int)lowDigits;
+
+      std::vector<DataT> high = ParseUnsignedRadixDivideConquer(num, start, split, radix, threshold);
+      std::vector<DataT> low = ParseUnsignedRadixDivideConquer(num, split + 1, end, radix, threshold);
+      std::vector<DataT> result = Add(Multiply(high, RadixPower(radix, lowDigits), CurrentBase), low, CurrentBase);
+      TrimZerosToOne(result);
+      return result;
+    }
+  }
+
+  std::vector<DataT> ParseUnsignedRadix(char const *num, Int start, Int end, SizeT radix)
+  {
+    CheckRadix(radix);
+    if (std::has_single_bit(radix))
+      return ParseUnsignedPow2(num, start, end, radix);
+    if (radix == 10)
+      return ParseUnsigned(num, start, end);
+    if (start > end)
+      return std::vector<DataT>{0};
+    return ParseUnsignedRadixDivideConquer(num, start, end, radix, ScaleDigits(DecimalDcThreshold, radix));
+  }
+
+  BigInteger ParseRadix(char const *num, SizeT radix, Int *char_processed)
+  {
+    CheckRadix(radix);
+    if (std::has_single_bit(radix))
+      return ParseRadixPow2(num, radix, char_processed);
+    if (radix == 10)
+      return Parse(num, char_processed);
+    if (num == nullptr)
+      return BigInteger();
+
+    Int start = 0;
+    bool isNegative = false;
+    if (num[0] == '-' || num[0] == '+')
+    {
+      isNegative = num[0] == '-';
+      start = 1;
+    }
+    while (num[start] == '0')
+      ++start;
+    Int end = start;
+    while (DigitValue(num[end], radix) < radix)
+      ++end;
+    if (char_processed != nullptr)
+      *char_processed = end;
+
+    if (start == end)
+      return BigInteger();
+    return BigInteger(ParseUnsignedRadix(num, start, end - 1, radix), isNegative);
+  }
+
+  std::string ToStringRadix(std::vector<DataT> const &bigInt, SizeT radix, bool isNeg)
+  {
+    CheckRadix(radix);
+    if (std::has_single_bit(radix))
+      return ToStringPow2(bigInt, radix, isNeg);
+    if (IsZero(bigInt))
+      return std::string("0");
+    if (radix == 10)
+      return ToString(bigInt, isNeg);
+
+    std::vector<DataT> r(bigInt);
+    while (r.size() > 1 && r.back() == 0)
+      r.pop_back();
+
+    SizeT approxDigits = EstimateDigits(r, radix);
+
+    std::string s;
+    s.reserve(approxDigits + (isNeg ? 2 : 1));
+    if (isNeg)
+      s.push_back('-');
+
+    if (approxDigits < ScaleDigits(ToStringDcThreshold, radix))
+    {
+      ToStringRadixLinearAppend(std::move(r), radix, 0, s);
+      return s;
+    }
+
+    auto const &chain = GetRadixDcChain(radix, approxDigits / 2);
+    ToStringDivConquer(std::move(r), chain, radix, 0, 0, s);
+    return s;
+  }
+
+  std::string ToStringRadix(BigInteger const &bigInt, SizeT radix)
+  {
+    return ToStringRadix(bigInt.GetInteger(), radix, bigInt.IsNegative());
+  }
 }
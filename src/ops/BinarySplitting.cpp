@@ -0,0 +1,149 @@
+/**
+ * BigMath: Binary splitting for hypergeometric-type series.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <exception>
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/ops/BinarySplitting.h"
+#include "biginteger/algorithms/Division.h"
+#include "biginteger/algorithms/Squaring.h"
+#include "biginteger/algorithms/division/NewtonDivision.h"
+#include "biginteger/common/Parallel.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Multiplication.h"
+
+namespace BigMath
+{
+  namespace
+  {
+    bool Prepare(BigInteger const &shared, SizeT otherLimbs)
+    {
+      return shared.GetInteger().size() + otherLimbs >= NTT_MULTIPLICATION_THRESHOLD;
+    }
+
+    // x·y, squaring when both halves are the same number.
+    BigInteger Product(BigInteger const &x, BigInteger const &y)
+    {
+      if (x.GetInteger().size() == y.GetInteger().size() && x.CompareTo(y) == 0)
+        return BigInteger(Square(x.GetInteger(), BigInteger::Base()), false);
+      return x * y;
+    }
+
+    BinarySplitting::Result Recurse(BinarySplitting::Generator const &term,
+                                    ULong n1, ULong n2, bool needP)
+    {
+      if (n2 - n1 == 1)
+      {
+        BinarySplitting::Term t = term(n1);
+        if (t.q.Zero())
+          throw invalid_argument("Division by zero");
+        BinarySplitting::Result r;
+        r.T = t.a * t.p;
+        r.Q = std::move(t.q);
+        if (needP)
+          r.P = std::move(t.p);
+        return r;
+      }
+      ULong m = n1 + (n2 - n1) / 2;
+      BinarySplitting::Result left = Recurse(term, n1, m, true);
+      BinarySplitting::Result right = Recurse(term, m, n2, needP);
+      return BinarySplitting::Merge(left, right, needP);
+    }
+  }
+
+  BinarySplitting::Result BinarySplitting::Merge(Result const &left, Result const &right, bool needP)
+  {
+    Result r;
+    SizeT other = (SizeT)std::max(left.Q.GetInteger().size(), left.T.GetInteger().size());
+    BigInteger tl;
+    if (Prepare(right.Q, other))
+    {
+      PreparedMultiplication byQr(right.Q, other);
+      r.Q = byQr * left.Q;
+      tl = byQr * left.T;
+    }
+    else
+    {
+      r.Q = Product(left.Q, right.Q);
+      tl = left.T * right.Q;
+    }
+
+    other = (SizeT)std::max(right.T.GetInteger().size(), needP ? right.P.GetInteger().size() : 0);
+    BigInteger tr;
+    if (needP && Prepare(left.P, other))
+    {
+      PreparedMultiplication byPl(left.P, other);
+      tr = byPl * right.T;
+      r.P = byPl * right.P;
+    }
+    else
+    {
+      tr = left.P * right.T;
+      if (needP)
+        r.P = Product(left.P, right.P);
+    }
+    r.T = tl + tr;
+    return r;
+  }
+
+  BinarySplitting::Result BinarySplitting::Evaluate(Generator const &term, ULong n1, ULong n2, bool needP)
+  {
+    if (n2 <= n1)
+      throw invalid_argument("Empty binary splitting range");
+
+    SizeT threads = ParallelNumThreads();
+    ULong count = n2 - n1;
+    if (threads <= 1 || count < BINARY_SPLITTING_PARALLEL_TERMS)
+      return Recurse(term, n1, n2, needP);
+
+    // One subrange per thread (a power of two, so the merges pair up as
+    // they would in the serial recursion).
+    SizeT parts = 1;
+    while (parts < threads)
+      parts *= 2;
+    vector<ULong> bounds(parts + 1);
+    for (SizeT i = 0; i <= parts; ++i)
+      bounds[i] = n1 + count * i / parts;
+
+    // Exceptions from the generator are carried back to the caller.
+    vector<Result> results(parts);
+    vector<std::exception_ptr> errors(parts);
+    ParallelDo((Int)parts, [&](Int start, Int end) {
+      for (Int i = start; i < end; ++i)
+      {
+        try
+        {
+          results[i] = Recurse(term, bounds[i], bounds[i + 1], needP || i + 1 < (Int)parts);
+        }
+        catch (...)
+        {
+          errors[i] = std::current_exception();
+        }
+      }
+    });
+    for (auto const &error : errors)
+      if (error)
+        std::rethrow_exception(error);
+
+    for (SizeT width = 1; width < parts; width *= 2)
+      for (SizeT i = 0; i + width < parts; i += 2 * width)
+        results[i] = Merge(results[i], results[i + width], needP || i + 2 * width < parts);
+    return results[0];
+  }
+
+  BigInteger BinarySplitting::Quotient(Result const &result, BigInteger const &scale)
+  {
+    vector<DataT> num = Multiply(result.T.GetInteger(), scale.GetInteger(), BigInteger::Base());
+    TrimZerosToOne(num);
+    vector<DataT> const &den = result.Q.GetInteger();
+    vector<DataT> q = den.size() >= NEWTON_MEDIUM_B
+                          ? NewtonDivision::Divide(num, den, BigInteger::Base())
+                          : Divide(num, den, BigInteger::Base());
+    bool negative = (result.T.IsNegative() != result.Q.IsNegative()) != scale.IsNegative();
+    return BigInteger(q, negative);
+  }
+}
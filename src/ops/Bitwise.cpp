@@ -0,0 +1,179 @@
+/**
+ * BigMath: BigInteger bitwise operations.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "biginteger/ops/Bitwise.h"
+#include "biginteger/algorithms/Shift.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Subtraction.h"
+
+namespace BigMath
+{
+  namespace
+  {
+    enum class Op
+    {
+      And,
+      Or,
+      Xor
+    };
+
+    bool Apply(Op op, bool x, bool y)
+    {
+      switch (op)
+      {
+      case Op::And: return x && y;
+      case Op::Or: return x || y;
+      default: return x != y;
+      }
+    }
+
+    BigInteger Combine(BigInteger const &x, BigInteger const &y, Op op)
+    {
+      // All three are symmetric: let a be the longer operand.
+      bool swap = x.size() < y.size();
+      BigInteger const &a = swap ? y : x;
+      BigInteger const &b = swap ? x : y;
+      bool aNeg = a.IsNegative();
+      bool bNeg = b.IsNegative();
+
+      // One limb above the longer magnitude holds the sign.
+      SizeT n = a.size() + 1;
+      SizeT nb = b.size();
+      vector<DataT> r(n, 0);
+      std::copy(a.GetInteger().begin(), a.GetInteger().end(), r.begin());
+      if (aNeg)
+        NegateTo(r.data(), n);
+
+      // The low limbs of b's two's complement fit in its own length; above
+      // that it is all zeros or all ones.
+      vector<DataT> t = b.GetInteger();
+      if (bNeg)
+        NegateTo(t.data(), nb);
+      switch (op)
+      {
+      case Op::And:
+        AndTo(r.data(), t.data(), nb);
+        if (!bNeg)
+          std::fill(r.begin() + nb, r.end(), 0);
+        break;
+      case Op::Or:
+        OrTo(r.data(), t.data(), nb);
+        if (bNeg)
+          std::fill(r.begin() + nb, r.end(), LimbMask);
+        break;
+      case Op::Xor:
+        XorTo(r.data(), t.data(), nb);
+        if (bNeg)
+          NotTo(r.data() + nb, n - nb);
+        break;
+      }
+
+      bool negative = Apply(op, aNeg, bNeg);
+      if (negative)
+        NegateTo(r.data(), n);
+      return BigInteger(r, negative);
+    }
+
+    BigInteger One()
+    {
+      return BigInteger(vector<DataT>{1}, false);
+    }
+
+    BigInteger PowerOfTwo(ULong i)
+    {
+      return BigInteger(ShiftLeftBits(vector<DataT>{1}, i), false);
+    }
+
+    // |a| − 1 for a < 0: the complement of a, which is non-negative.
+    BigInteger Complement(BigInteger const &a)
+    {
+      return BigInteger(a.GetInteger(), false) - One();
+    }
+  }
+
+  BigInteger operator&(BigInteger const &a, BigInteger const &b)
+  {
+    return Combine(a, b, Op::And);
+  }
+
+  BigInteger operator|(BigInteger const &a, BigInteger const &b)
+  {
+    return Combine(a, b, Op::Or);
+  }
+
+  BigInteger operator^(BigInteger const &a, BigInteger const &b)
+  {
+    return Combine(a, b, Op::Xor);
+  }
+
+  // ~a = −a − 1.
+  BigInteger operator~(BigInteger const &a)
+  {
+    if (a.IsNegative())
+      return Complement(a);
+    return BigInteger((a + One()).GetInteger(), true);
+  }
+
+  bool TestBit(BigInteger const &a, ULong i)
+  {
+    vector<DataT> const &m = a.GetInteger();
+    ULong limb = i / LimbBits;
+    bool bit = limb < m.size() && ((m[limb] >> (i % LimbBits)) & 1);
+    if (!a.IsNegative())
+      return bit;
+    // −m flips every bit above the lowest set bit of m.
+    ULong z = TrailingZeroBits(m);
+    return i == z || (i > z && !bit);
+  }
+
+  // Turning bit i on adds 2^i to the value, turning it off subtracts it,
+  // whatever the sign.
+  BigInteger SetBit(BigInteger const &a, ULong i)
+  {
+    return TestBit(a, i) ? a : a + PowerOfTwo(i);
+  }
+
+  BigInteger ClearBit(BigInteger const &a, ULong i)
+  {
+    return TestBit(a, i) ? a - PowerOfTwo(i) : a;
+  }
+
+  ULong PopCount(BigInteger const &a)
+  {
+    if (a.IsNegative())
+      return ~(ULong)0;
+    return PopCount(a.GetInteger().data(), a.size());
+  }
+
+  ULong HammingDistance(BigInteger const &a, BigInteger const &b)
+  {
+    if (a.IsNegative() != b.IsNegative())
+      return ~(ULong)0;
+    // ~a ^ ~b = a ^ b, and both complements are non-negative.
+    if (a.IsNegative())
+      return HammingDistance(Complement(a), Complement(b));
+
+    vector<DataT> const &x = a.size() >= b.size() ? a.GetInteger() : b.GetInteger();
+    vector<DataT> const &y = a.size() >= b.size() ? b.GetInteger() : a.GetInteger();
+    return XorPopCount(x.data(), y.data(), (SizeT)y.size()) +
+           PopCount(x.data() + y.size(), (SizeT)(x.size() - y.size()));
+  }
+
+  ULong BitLength(BigInteger const &a)
+  {
+    return BitLength(a.GetInteger());
+  }
+
+  ULong TrailingZeroBits(BigInteger const &a)
+  {
+    if (a.Zero())
+      return ~(ULong)0;
+    return TrailingZeroBits(a.GetInteger());
+  }
+}
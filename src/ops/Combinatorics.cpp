@@ -0,0 +1,25 @@
+/**
+ * BigMath: BigInteger factorial, binomial and primorial.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include "biginteger/ops/Combinatorics.h"
+
+namespace BigMath
+{
+  BigInteger Factorial(ULong n)
+  {
+    return BigInteger(Factorial(n, BigInteger::Base()), false);
+  }
+
+  BigInteger Binomial(ULong n, ULong k)
+  {
+    return BigInteger(Binomial(n, k, BigInteger::Base()), false);
+  }
+
+  BigInteger Primorial(ULong n)
+  {
+    return BigInteger(Primorial(n, BigInteger::Base()), false);
+  }
+}
@@ -29,6 +29,23 @@ namespace BigMath
 
   BigInteger operator%(BigInteger const &a, BigInteger const &b)
   {
-    return DivideAndRemainder(a, b).second;
+    return Remainder(a, b);
+  }
+
+  BigInteger Remainder(BigInteger const &a, BigInteger const &b)
+  {
+    auto rv = Remainder(a.GetInteger(), b.GetInteger(), BigInteger::Base());
+    return BigInteger(rv, a.IsNegative() || b.IsNegative());
+  }
+
+  bool IsDivisibleBy(BigInteger const &a, BigInteger const &b)
+  {
+    return IsDivisibleBy(a.GetInteger(), b.GetInteger(), BigInteger::Base());
+  }
+
+  BigInteger DivExact(BigInteger const &a, BigInteger const &b)
+  {
+    auto qv = DivExact(a.GetInteger(), b.GetInteger(), BigInteger::Base());
+    return BigInteger(qv, a.IsNegative() != b.IsNegative());
   }
 }
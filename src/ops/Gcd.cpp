@@ -0,0 +1,28 @@
+/**
+ * BigMath: BigInteger GCD and extended GCD.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include "biginteger/ops/Gcd.h"
+
+namespace BigMath
+{
+  BigInteger Gcd(BigInteger const &a, BigInteger const &b)
+  {
+    return BigInteger(Gcd(a.GetInteger(), b.GetInteger(), BigInteger::Base()), false);
+  }
+
+  BigInteger ExtendedGcd(BigInteger const &a, BigInteger const &b,
+                         BigInteger &s, BigInteger &t)
+  {
+    vector<DataT> sv, tv;
+    bool sNegative = false;
+    vector<DataT> g = ExtendedGcd(a.GetInteger(), b.GetInteger(), sv, tv, sNegative, BigInteger::Base());
+
+    // |g| = ±s·|a| ∓ t·|b|; fold the operand signs into the cofactors.
+    s = BigInteger(sv, sNegative != a.IsNegative());
+    t = BigInteger(tv, !sNegative != b.IsNegative());
+    return BigInteger(g, false);
+  }
+}
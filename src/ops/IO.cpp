@@ -6,9 +6,11 @@
 
 #include "biginteger/ops/IO.h"
 #include "biginteger/algorithms/Addition.h"
-#include "biginteger/algorithms/multiplication/ClassicMultiplication.h"
+#include "biginteger/algorithms/Multiplication.h"
 
 #include <iomanip>
+#include <string>
+#include <utility>
 
 namespace BigMath
 {
@@ -40,9 +42,32 @@ namespace BigMath
     return stream;
   }
 
-  // Fused extract + parse. Reads digits directly from the streambuf and folds 18 at
-  // a time into a base-2^32 limb vector. Avoids materializing the full digit string
-  // and the second scan that Parse would do on a captured std::string.
+  namespace
+  {
+    // Blocks of parsed digits and their digit counts, most significant first.
+    using DigitBlocks = std::vector<std::pair<std::vector<DataT>, SizeT>>;
+
+    // Appends a block of `digits` digits. Equal counts merge like a binary
+    // counter, hi · 10^d + lo, so the value is built from the balanced
+    // products of ParseUnsignedDivideConquer.
+    void PushBlock(DigitBlocks &blocks, std::vector<DataT> value, SizeT digits)
+    {
+      while (!blocks.empty() && blocks.back().second == digits)
+      {
+        value = Add(Multiply(blocks.back().first, Pow10(digits), CurrentBase), value, CurrentBase);
+        TrimZerosToOne(value);
+        digits *= 2;
+        blocks.pop_back();
+      }
+      blocks.emplace_back(std::move(value), digits);
+    }
+  }
+
+  // Fused extract + parse. Reads digits directly from the streambuf into a
+  // DecimalDcThreshold-digit block; each full block goes through
+  // ParseUnsignedLinear (vectorized chunks) and is merged by PushBlock. The
+  // full digit string is never materialized, and long inputs cost
+  // O(M(L) · log L) like Parse rather than a multiply-add per chunk.
   std::istream &operator>>(std::istream &stream, BigInteger &in)
   {
     bool isNegative = false;
@@ -54,56 +79,52 @@ namespace BigMath
     if (c == '-')
     {
       isNegative = true;
-      buf->sbumpc();
-      c = buf->sgetc();
+      c = buf->snextc();
     }
     else if (c == '+')
     {
-      buf->sbumpc();
-      c = buf->sgetc();
+      c = buf->snextc();
     }
 
     while (c == '0')
-    {
-      buf->sbumpc();
-      c = buf->sgetc();
-    }
+      c = buf->snextc();
 
-    std::vector<DataT> r;
-    r.reserve(64);
-    r.push_back(0);
-
-    ULong chunk = 0;
-    ULong chunkMul = 1;
+    std::string block(DecimalDcThreshold, '0');
+    SizeT n = 0;
+    DigitBlocks blocks;
     bool anyDigit = false;
 
     while (c >= '0' && c <= '9')
     {
-      chunk = chunk * 10 + (ULong)(c - '0');
-      chunkMul *= 10;
       anyDigit = true;
-      buf->sbumpc();
-      c = buf->sgetc();
-
-      if (chunkMul == Base10_18)
+      block[n++] = (char)c;
+      if (n == DecimalDcThreshold)
       {
-        ClassicMultiplication::MultiplyTo(r, Base10_18, CurrentBase);
-        AddTo(r, chunk, CurrentBase);
-        chunk = 0;
-        chunkMul = 1;
+        PushBlock(blocks, ParseUnsignedLinear(block.data(), 0, (Int)n - 1), n);
+        n = 0;
       }
+      c = buf->snextc();
     }
 
-    if (chunkMul > 1)
+    if (c == EOF)
+      stream.setstate(std::ios::eofbit);
+
+    if (!anyDigit)
     {
-      ClassicMultiplication::MultiplyTo(r, chunkMul, CurrentBase);
-      AddTo(r, chunk, CurrentBase);
+      in = BigInteger();
+      return stream;
     }
 
-    if (c == EOF)
-      stream.setstate(std::ios::eofbit);
+    std::vector<DataT> r = n > 0 ? ParseUnsignedLinear(block.data(), 0, (Int)n - 1) : std::vector<DataT>{0};
+    SizeT digits = n;
+    for (auto it = blocks.rbegin(); it != blocks.rend(); ++it)
+    {
+      r = Add(Multiply(it->first, Pow10(digits), CurrentBase), r, CurrentBase);
+      digits += it->second;
+    }
+    TrimZerosToOne(r);
 
-    in = anyDigit ? BigInteger(r, isNegative) : BigInteger();
+    in = BigInteger(r, isNegative);
     return stream;
   }
 }
@@ -0,0 +1,131 @@
+/**
+ * BigMath: Modular arithmetic over a fixed modulus.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <stdexcept>
+
+#include "biginteger/ops/Modular.h"
+#include "biginteger/ops/Division.h"
+#include "biginteger/ops/Gcd.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Subtraction.h"
+
+namespace BigMath
+{
+  static BigInteger CheckedModulus(BigInteger const &m)
+  {
+    if (m.IsNegative() || m.Zero() || (m.GetInteger()[0] & 1) == 0)
+      throw invalid_argument("Montgomery modulus must be positive and odd");
+    return m;
+  }
+
+  MontgomeryContext::MontgomeryContext(BigInteger const &m)
+      : modulus(CheckedModulus(m)),
+        context(m.GetInteger())
+  {
+  }
+
+  vector<DataT> MontgomeryContext::Reduce(BigInteger const &a) const
+  {
+    vector<DataT> r = a.GetInteger();
+    if (Compare(r, context.Modulus()) >= 0)
+      r = Remainder(r, context.Modulus(), BigInteger::Base());
+    TrimZerosToOne(r);
+    if (a.IsNegative() && !IsZero(r))
+      r = Subtract(context.Modulus(), r, BigInteger::Base());
+    TrimZerosToOne(r);
+    return r;
+  }
+
+  BigInteger MontgomeryContext::ToMontgomery(BigInteger const &a) const
+  {
+    return BigInteger(context.ToMontgomery(Reduce(a)), false);
+  }
+
+  BigInteger MontgomeryContext::FromMontgomery(BigInteger const &a) const
+  {
+    return BigInteger(context.FromMontgomery(a.GetInteger()), false);
+  }
+
+  BigInteger MontgomeryContext::MontgomeryMultiply(BigInteger const &a, BigInteger const &b) const
+  {
+    return BigInteger(context.MultiplyReduce(a.GetInteger(), b.GetInteger()), false);
+  }
+
+  BigInteger MontgomeryContext::MontgomerySquare(BigInteger const &a) const
+  {
+    return BigInteger(context.SquareReduce(a.GetInteger()), false);
+  }
+
+  BigInteger MontgomeryContext::ModMul(BigInteger const &a, BigInteger const &b) const
+  {
+    // REDC(a·b) = a·b·R⁻¹; one more REDC against R² restores the factor R.
+    vector<DataT> t = context.MultiplyReduce(Reduce(a), Reduce(b));
+    return BigInteger(context.ToMontgomery(t), false);
+  }
+
+  BigInteger MontgomeryContext::ModSqr(BigInteger const &a) const
+  {
+    vector<DataT> t = context.SquareReduce(Reduce(a));
+    return BigInteger(context.ToMontgomery(t), false);
+  }
+
+  BigInteger MontgomeryContext::ModPow(BigInteger const &a, BigInteger const &exponent) const
+  {
+    if (exponent.IsNegative())
+      throw invalid_argument("Negative exponent");
+    vector<DataT> x = context.ToMontgomery(Reduce(a));
+    return BigInteger(context.FromMontgomery(context.Pow(x, exponent.GetInteger())), false);
+  }
+
+  BigInteger ModInverse(BigInteger const &a, BigInteger const &m)
+  {
+    if (m.Zero())
+      throw invalid_argument("Division by zero");
+    BigInteger mod(m.GetInteger(), false);
+    BigInteger s, t;
+    BigInteger g = ExtendedGcd(a, mod, s, t);
+    if (g.CompareTo(BigInteger(vector<DataT>{1}, false)) != 0)
+      throw invalid_argument("Value is not invertible modulo m");
+
+    BigInteger r(Remainder(s, mod).GetInteger(), false);
+    if (s.IsNegative() && !r.Zero())
+      r = mod - r;
+    return r;
+  }
+
+  BigInteger ModPow(BigInteger const &a, BigInteger const &exponent, BigInteger const &m)
+  {
+    if (m.Zero())
+      throw invalid_argument("Division by zero");
+    if (exponent.IsNegative())
+      return ModPow(ModInverse(a, m), BigInteger(exponent.GetInteger(), false), m);
+
+    BigInteger mod(m.GetInteger(), false);
+    if (mod.GetInteger()[0] & 1)
+      return MontgomeryContext(mod).ModPow(a, exponent);
+
+    BarrettReducer reducer(mod);
+    auto reduce = [&](BigInteger const &v)
+    {
+      BigInteger r(reducer.Reduce(v).GetInteger(), false);
+      if (v.IsNegative() && !r.Zero())
+        r = mod - r;
+      return r;
+    };
+
+    vector<DataT> const &e = exponent.GetInteger();
+    SizeT bits = BitLength(e);
+    BigInteger base = reduce(a);
+    BigInteger result = reduce(BigInteger(vector<DataT>{1}, false));
+    for (Int i = (Int)bits - 1; i >= 0; --i)
+    {
+      result = reduce(result * result);
+      if (MontgomeryReduction::TestBit(e, (SizeT)i))
+        result = reduce(result * base);
+    }
+    return result;
+  }
+}
@@ -0,0 +1,15 @@
+/**
+ * BigMath: BigInteger integer power.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include "biginteger/ops/Power.h"
+
+namespace BigMath
+{
+  BigInteger Pow(BigInteger const &a, ULong e)
+  {
+    return BigInteger(Pow(a.GetInteger(), e, BigInteger::Base()), a.IsNegative() && (e & 1));
+  }
+}
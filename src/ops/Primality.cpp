@@ -0,0 +1,298 @@
+/**
+ * BigMath: probable-prime testing (Baillie–PSW).
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include "biginteger/ops/Primality.h"
+#include "biginteger/algorithms/combinatorics/PrimeSwing.h"
+#include "biginteger/algorithms/division/ClassicDivision.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/common/Parallel.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Bitwise.h"
+#include "biginteger/ops/Division.h"
+#include "biginteger/ops/Modular.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/ProductTree.h"
+#include "biginteger/ops/Root.h"
+#include "biginteger/ops/ScalarDivision.h"
+#include "biginteger/ops/Shift.h"
+#include "biginteger/ops/Subtraction.h"
+
+namespace BigMath
+{
+  namespace
+  {
+    // The odd primes below the trial bound, packed into words below 2^64.
+    struct SmallPrimes
+    {
+      vector<ULong> primes;
+      vector<ULong> words;
+      // primes[first[w]] … primes[first[w + 1] − 1] make up words[w].
+      vector<SizeT> first;
+      BigInteger product;
+      // Odd n below this with no listed factor is prime.
+      BigInteger squaredBound;
+
+      SmallPrimes()
+      {
+        ULong bound = BIGMATH_PRIMALITY_TRIAL_BOUND;
+        PrimeSieve sieve(bound - 1);
+        sieve.ForEach(bound - 1, [&](ULong p) {
+          if (p != 2)
+            primes.push_back(p);
+        });
+
+        vector<BigInteger> leaves;
+        ULong acc = 1;
+        first.push_back(0);
+        for (SizeT i = 0; i < primes.size(); ++i)
+        {
+          if (acc > ~(ULong)0 / primes[i])
+          {
+            words.push_back(acc);
+            first.push_back(i);
+            acc = 1;
+          }
+          acc *= primes[i];
+        }
+        words.push_back(acc);
+        first.push_back((SizeT)primes.size());
+
+        for (ULong w : words)
+          leaves.push_back(BigIntegerBuilder::From(w));
+        product = ProductTree(leaves).Product();
+        squaredBound = BigIntegerBuilder::From(bound * bound);
+      }
+    };
+
+    SmallPrimes const &Table()
+    {
+      static SmallPrimes const table;
+      return table;
+    }
+
+    enum class Trial
+    {
+      Composite,
+      Prime,
+      Unknown
+    };
+
+    // n odd and at least 3.
+    Trial TrialDivision(BigInteger const &n)
+    {
+      SmallPrimes const &t = Table();
+      vector<DataT> const r = (n.CompareTo(t.product) < 0 ? n : n % t.product).GetInteger();
+      for (SizeT w = 0; w < t.words.size(); ++w)
+      {
+        ULong residue = ClassicDivision::Mod(r, (DataT)t.words[w], BigInteger::Base());
+        for (SizeT i = t.first[w]; i < t.first[w + 1]; ++i)
+          if (residue % t.primes[i] == 0)
+            return n.CompareTo(BigIntegerBuilder::From(t.primes[i])) == 0 ? Trial::Prime : Trial::Composite;
+      }
+      return n.CompareTo(t.squaredBound) < 0 ? Trial::Prime : Trial::Unknown;
+    }
+
+    // Jacobi symbol (a / m) for odd m.
+    Int Jacobi(ULong a, ULong m)
+    {
+      Int j = 1;
+      a %= m;
+      while (a != 0)
+      {
+        while ((a & 1) == 0)
+        {
+          a >>= 1;
+          if ((m & 7) == 3 || (m & 7) == 5)
+            j = -j;
+        }
+        std::swap(a, m);
+        if ((a & 3) == 3 && (m & 3) == 3)
+          j = -j;
+        a %= m;
+      }
+      return m == 1 ? j : 0;
+    }
+
+    // (d / n) for a small odd |d| and odd n > |d|, by reciprocity.
+    Int Jacobi(Long d, BigInteger const &n)
+    {
+      ULong a = (ULong)(d < 0 ? -d : d);
+      BigInteger rem = n % (DataT)a;
+      ULong r = rem.Zero() ? 0 : (ULong)rem.GetInteger()[0];
+      Int j = Jacobi(r, a);
+      ULong n4 = (ULong)n.GetInteger()[0] & 3;
+      if ((a & 3) == 3 && n4 == 3)
+        j = -j;
+      if (d < 0 && n4 == 3)
+        j = -j;
+      return j;
+    }
+
+    // Arithmetic modulo n on values in [0, n).
+    class Residues
+    {
+    public:
+      explicit Residues(BigInteger const &n) : n(n), mont(n)
+      {
+      }
+
+      MontgomeryContext const &Context() const { return mont; }
+
+      BigInteger Sub(BigInteger const &a, BigInteger const &b) const
+      {
+        BigInteger r = a - b;
+        return r.IsNegative() ? r + n : r;
+      }
+
+      BigInteger Twice(BigInteger const &a) const
+      {
+        BigInteger r = a + a;
+        return r.CompareTo(n) >= 0 ? r - n : r;
+      }
+
+      BigInteger Mul(BigInteger const &a, BigInteger const &b) const
+      {
+        return mont.MontgomeryMultiply(a, b);
+      }
+
+      BigInteger Sqr(BigInteger const &a) const
+      {
+        return mont.MontgomerySquare(a);
+      }
+
+    private:
+      BigInteger n;
+      MontgomeryContext mont;
+    };
+
+    // Strong Fermat test to base a, with n − 1 = d·2^s.
+    bool StrongFermat(Residues const &z, BigInteger const &a, BigInteger const &d, SizeT s,
+                      BigInteger const &one, BigInteger const &minusOne)
+    {
+      MontgomeryContext const &mont = z.Context();
+      BigInteger x = mont.ToMontgomery(mont.ModPow(a, d));
+      if (x.CompareTo(one) == 0 || x.CompareTo(minusOne) == 0)
+        return true;
+      for (SizeT r = 1; r < s; ++r)
+      {
+        x = z.Sqr(x);
+        if (x.CompareTo(minusOne) == 0)
+          return true;
+        if (x.CompareTo(one) == 0)
+          return false;
+      }
+      return false;
+    }
+
+    // Strong Lucas test with Selfridge's parameters.
+    bool StrongLucas(BigInteger const &n, Residues const &z)
+    {
+      Long d = 5;
+      for (SizeT tries = 0;; ++tries)
+      {
+        Int j = Jacobi(d, n);
+        if (j == -1)
+          break;
+        if (j == 0)
+          return false; // |d| is a proper factor; n > |d|.
+        // A square never gives −1; check once the search drags on.
+        if (tries == 8)
+        {
+          BigInteger root = Sqrt(n);
+          if ((root * root).CompareTo(n) == 0)
+            return false;
+        }
+        d = d > 0 ? -(d + 2) : -d + 2;
+      }
+
+      MontgomeryContext const &mont = z.Context();
+      BigInteger const q = mont.ToMontgomery(BigIntegerBuilder::From((Long)((1 - d) / 4)));
+      BigInteger const one = mont.ToMontgomery(BigInteger(vector<DataT>{1}, false));
+
+      // n + 1 = k·2^s with k odd; walk (V_i, V_i+1, Q^i) up to i = k. P = 1.
+      BigInteger np1 = n + BigInteger(vector<DataT>{1}, false);
+      SizeT s = (SizeT)TrailingZeroBits(np1);
+      BigInteger k = ShiftRightBits(np1, s);
+      BigInteger v = z.Twice(one), w = one, qk = one;
+      for (SizeT i = (SizeT)BitLength(k); i-- > 0;)
+      {
+        if (TestBit(k, i))
+        {
+          v = z.Sub(z.Mul(v, w), qk);
+          w = z.Sub(z.Sqr(w), z.Twice(z.Mul(qk, q)));
+          qk = z.Mul(z.Sqr(qk), q);
+        }
+        else
+        {
+          w = z.Sub(z.Mul(v, w), qk);
+          v = z.Sub(z.Sqr(v), z.Twice(qk));
+          qk = z.Sqr(qk);
+        }
+      }
+
+      // D·U_k = 2·V_k+1 − P·V_k, and gcd(D, n) = 1.
+      if (z.Sub(z.Twice(w), v).Zero() || v.Zero())
+        return true;
+      for (SizeT r = 1; r < s; ++r)
+      {
+        v = z.Sub(z.Sqr(v), z.Twice(qk));
+        if (v.Zero())
+          return true;
+        qk = z.Sqr(qk);
+      }
+      return false;
+    }
+  }
+
+  bool IsProbablePrime(BigInteger const &n, SizeT extraRounds)
+  {
+    if (n.IsNegative() || n.Zero())
+      return false;
+    vector<DataT> const &v = n.GetInteger();
+    if (v.size() == 1 && v[0] < 4)
+      return v[0] >= 2;
+    if ((v[0] & 1) == 0)
+      return false;
+
+    Trial trial = TrialDivision(n);
+    if (trial != Trial::Unknown)
+      return trial == Trial::Prime;
+
+    Residues z(n);
+    MontgomeryContext const &mont = z.Context();
+    BigInteger nm1 = n - BigInteger(vector<DataT>{1}, false);
+    SizeT s = (SizeT)TrailingZeroBits(nm1);
+    BigInteger d = ShiftRightBits(nm1, s);
+    BigInteger one = mont.ToMontgomery(BigInteger(vector<DataT>{1}, false));
+    BigInteger minusOne = mont.ToMontgomery(nm1);
+
+    if (!StrongFermat(z, BigInteger(vector<DataT>{2}, false), d, s, one, minusOne))
+      return false;
+    if (!StrongLucas(n, z))
+      return false;
+
+    vector<ULong> const &primes = Table().primes;
+    for (SizeT i = 0; i < extraRounds && i < primes.size(); ++i)
+      if (!StrongFermat(z, BigIntegerBuilder::From(primes[i]), d, s, one, minusOne))
+        return false;
+    return true;
+  }
+
+  vector<bool> IsProbablePrime(vector<BigInteger> const &candidates, SizeT extraRounds)
+  {
+    vector<char> prime(candidates.size(), 0);
+    std::atomic<SizeT> next{0};
+    Int workers = (Int)std::min<SizeT>(ParallelNumThreads(), (SizeT)candidates.size());
+    ParallelDo(workers, [&](Int, Int) {
+      for (SizeT i; (i = next.fetch_add(1)) < candidates.size();)
+        prime[i] = IsProbablePrime(candidates[i], extraRounds);
+    });
+    return vector<bool>(prime.begin(), prime.end());
+  }
+}
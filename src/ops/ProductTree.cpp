@@ -0,0 +1,187 @@
+/**
+ * BigMath: product trees, remainder trees and CRT reconstruction.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+
+#include "biginteger/ops/ProductTree.h"
+#include "biginteger/algorithms/division/ClassicDivision.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Modular.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Subtraction.h"
+
+namespace BigMath
+{
+  ProductTree::ProductTree(vector<BigInteger> const &leaves)
+  {
+    if (leaves.empty())
+      throw invalid_argument("Empty product tree");
+    levels.push_back(leaves);
+    while (levels.back().size() > 1)
+    {
+      vector<BigInteger> const &below = levels.back();
+      vector<BigInteger> next;
+      next.reserve((below.size() + 1) / 2);
+      for (SizeT i = 0; i < below.size(); i += 2)
+        next.push_back(i + 1 < below.size() ? below[i] * below[i + 1] : below[i]);
+      levels.push_back(std::move(next));
+    }
+  }
+
+  namespace
+  {
+    vector<BigInteger> Magnitudes(vector<BigInteger> const &moduli)
+    {
+      vector<BigInteger> m;
+      m.reserve(moduli.size());
+      for (BigInteger const &x : moduli)
+      {
+        if (x.Zero())
+          throw invalid_argument("Division by zero");
+        m.push_back(BigInteger(x.GetInteger(), false));
+      }
+      return m;
+    }
+  }
+
+  RemainderTree::RemainderTree(vector<BigInteger> const &moduli)
+      : tree(Magnitudes(moduli))
+  {
+    divider.resize(tree.Depth());
+    for (SizeT j = 0; j < tree.Depth(); ++j)
+    {
+      for (BigInteger const &node : tree.Level(j))
+      {
+        if (node.GetInteger().size() < NEWTON_MEDIUM_B)
+          divider[j].push_back(-1);
+        else
+        {
+          divider[j].push_back((Int)dividers.size());
+          dividers.emplace_back(node);
+        }
+      }
+    }
+
+    for (BigInteger const &m : tree.Leaves())
+    {
+      if (m.GetInteger().size() != 1)
+        return;
+    }
+    // Nodes grow up the tree, so the first level with a long node ends it.
+    for (SizeT j = 1; j < tree.Depth(); ++j)
+    {
+      SizeT longest = 0;
+      for (BigInteger const &node : tree.Level(j))
+        longest = std::max(longest, (SizeT)node.GetInteger().size());
+      if (longest > BIGMATH_REMAINDER_BATCH_LIMBS)
+        break;
+      batchLevel = j;
+    }
+    if (batchLevel > 0)
+    {
+      for (BigInteger const &m : tree.Leaves())
+        limbModuli.push_back(m.GetInteger()[0]);
+    }
+  }
+
+  // a mod node (level, i) for a ≥ 0.
+  BigInteger RemainderTree::Reduce(BigInteger const &a, SizeT level, SizeT i) const
+  {
+    BigInteger const &node = tree.Level(level)[i];
+    if (a.CompareTo(node) < 0)
+      return a;
+    Int d = divider[level][i];
+    return d < 0 ? a % node : dividers[d].Remainder(a);
+  }
+
+  vector<BigInteger> RemainderTree::Remainders(BigInteger const &x) const
+  {
+    SizeT top = tree.Depth() - 1;
+    vector<BigInteger> cur{Reduce(BigInteger(x.GetInteger(), false), top, 0)};
+    for (SizeT j = top; j-- > batchLevel;)
+    {
+      vector<BigInteger> next(tree.Level(j).size());
+      for (SizeT i = 0; i < next.size(); ++i)
+        next[i] = Reduce(cur[i / 2], j, i);
+      cur = std::move(next);
+    }
+
+    if (batchLevel > 0)
+    {
+      // Node i of the batch level covers leaves [i·2^level, (i + 1)·2^level).
+      vector<BigInteger> leaves(limbModuli.size());
+      span<const DataT> moduli(limbModuli);
+      for (SizeT i = 0; i < cur.size(); ++i)
+      {
+        SizeT first = i << batchLevel;
+        SizeT count = std::min<SizeT>((SizeT)1 << batchLevel, (SizeT)moduli.size() - first);
+        vector<DataT> r = ClassicDivision::Mod(cur[i].GetInteger(), moduli.subspan(first, count), BigInteger::Base());
+        for (SizeT t = 0; t < count; ++t)
+          leaves[first + t] = BigInteger(vector<DataT>{r[t]}, false);
+      }
+      cur = std::move(leaves);
+    }
+
+    if (x.IsNegative())
+      for (SizeT i = 0; i < cur.size(); ++i)
+        if (!cur[i].Zero())
+          cur[i] = tree.Leaves()[i] - cur[i];
+    return cur;
+  }
+
+  BigInteger RemainderTree::FromResidues(vector<BigInteger> const &residues) const
+  {
+    vector<BigInteger> const &moduli = tree.Leaves();
+    if (residues.size() != moduli.size())
+      throw invalid_argument("Residue count does not match the moduli");
+    SizeT top = tree.Depth() - 1;
+
+    // (M/N) mod N, top down; M/M = 1.
+    vector<BigInteger> cofactor{Reduce(BigInteger(vector<DataT>{1}, false), top, 0)};
+    for (SizeT j = top; j-- > 0;)
+    {
+      vector<BigInteger> const &level = tree.Level(j);
+      vector<BigInteger> next(level.size());
+      for (SizeT i = 0; i < next.size(); ++i)
+      {
+        SizeT sibling = i ^ 1;
+        if (sibling >= level.size())
+          next[i] = cofactor[i / 2];
+        else
+          next[i] = Reduce(Reduce(cofactor[i / 2], j, i) * Reduce(level[sibling], j, i), j, i);
+      }
+      cofactor = std::move(next);
+    }
+
+    // sᵢ = rᵢ · cofactorᵢ⁻¹ mod mᵢ.
+    vector<BigInteger> sum(moduli.size());
+    for (SizeT i = 0; i < moduli.size(); ++i)
+    {
+      BigInteger r = Reduce(BigInteger(residues[i].GetInteger(), false), 0, i);
+      if (residues[i].IsNegative() && !r.Zero())
+        r = moduli[i] - r;
+      sum[i] = Reduce(r * ModInverse(cofactor[i], moduli[i]), 0, i);
+    }
+
+    // v_N = v_L·R + v_R·L, bottom up.
+    for (SizeT j = 0; j < top; ++j)
+    {
+      vector<BigInteger> const &level = tree.Level(j);
+      vector<BigInteger> next((level.size() + 1) / 2);
+      for (SizeT i = 0; i < next.size(); ++i)
+      {
+        if (2 * i + 1 < level.size())
+          next[i] = sum[2 * i] * level[2 * i + 1] + sum[2 * i + 1] * level[2 * i];
+        else
+          next[i] = std::move(sum[2 * i]);
+      }
+      sum = std::move(next);
+    }
+    return Reduce(sum[0], top, 0);
+  }
+}
@@ -0,0 +1,83 @@
+/**
+ * BigMath: Uniform random BigIntegers.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/ops/Random.h"
+#include "biginteger/algorithms/Shift.h"
+#include "biginteger/common/Comparator.h"
+#include "biginteger/common/Parallel.h"
+
+namespace BigMath
+{
+  namespace
+  {
+    // Mask for the top limb of a bits-long value.
+    DataT TopMask(ULong bits)
+    {
+      SizeT top = (SizeT)(bits % LimbBits);
+      return top == 0 ? LimbMask : ((DataT)1 << top) - 1;
+    }
+
+    SizeT Limbs(ULong bits)
+    {
+      return (SizeT)((bits + LimbBits - 1) / LimbBits);
+    }
+  }
+
+  BigInteger RandomBits(ULong bits, RandomGenerator &rng)
+  {
+    if (bits == 0)
+      return BigInteger();
+    vector<DataT> r(Limbs(bits));
+    rng.Fill(r.data(), (SizeT)r.size());
+    r.back() &= TopMask(bits);
+    return BigInteger(r, false);
+  }
+
+  BigInteger RandomBelow(BigInteger const &bound, RandomGenerator &rng)
+  {
+    if (bound.Zero() || bound.IsNegative())
+      throw std::invalid_argument("Random bound must be positive");
+
+    vector<DataT> const &b = bound.GetInteger();
+    SizeT n = (SizeT)b.size();
+    DataT mask = TopMask(BitLength(b));
+    vector<DataT> r(n);
+    for (;;)
+    {
+      // The lower limbs are independent of the top one, so rejecting on the
+      // top limb before drawing them keeps the result uniform.
+      do
+        r[n - 1] = rng.Next() & mask;
+      while (r[n - 1] > b[n - 1]);
+      rng.Fill(r.data(), n - 1);
+      if (Compare(r, b) < 0)
+        return BigInteger(r, false);
+    }
+  }
+
+  BigInteger RandomBits(ULong bits, ULong seed)
+  {
+    if (bits == 0)
+      return BigInteger();
+    SizeT n = Limbs(bits);
+    SizeT blocks = (n + BIGMATH_RANDOM_BLOCK - 1) / BIGMATH_RANDOM_BLOCK;
+    vector<DataT> r(n);
+    RandomGenerator root(seed);
+    ParallelDo((Int)blocks, [&](Int start, Int end) {
+      for (Int k = start; k < end; ++k)
+      {
+        SizeT offset = (SizeT)k * BIGMATH_RANDOM_BLOCK;
+        root.Split((ULong)k).Fill(r.data() + offset, std::min<SizeT>(BIGMATH_RANDOM_BLOCK, n - offset));
+      }
+    });
+    r.back() &= TopMask(bits);
+    return BigInteger(r, false);
+  }
+}
@@ -0,0 +1,45 @@
+/**
+ * BigMath: BigInteger square root and k-th root.
+ *
+ * S. M. Mahbub Murshed (murshed@gmail.com)
+ */
+
+#include <stdexcept>
+
+#include "biginteger/ops/Root.h"
+
+namespace BigMath
+{
+  BigInteger Sqrt(BigInteger const &a)
+  {
+    BigInteger remainder;
+    return SqrtRem(a, remainder);
+  }
+
+  BigInteger SqrtRem(BigInteger const &a, BigInteger &remainder)
+  {
+    if (a.IsNegative())
+      throw invalid_argument("Square root of a negative number");
+    vector<DataT> r;
+    vector<DataT> s = SqrtRem(a.GetInteger(), r, BigInteger::Base());
+    remainder = BigInteger(r, false);
+    return BigInteger(s, false);
+  }
+
+  BigInteger Root(BigInteger const &a, SizeT k)
+  {
+    BigInteger remainder;
+    return RootRem(a, k, remainder);
+  }
+
+  BigInteger RootRem(BigInteger const &a, SizeT k, BigInteger &remainder)
+  {
+    bool negative = a.IsNegative();
+    if (negative && k % 2 == 0)
+      throw invalid_argument("Even root of a negative number");
+    vector<DataT> r;
+    vector<DataT> x = RootRem(a.GetInteger(), k, r, BigInteger::Base());
+    remainder = BigInteger(r, negative);
+    return BigInteger(x, negative);
+  }
+}
@@ -45,6 +45,27 @@ namespace BigMath
     return {q, r};
   }
 
+  BigInteger Remainder(BigInteger const &a, DataT b)
+  {
+    DataT r = Remainder(a.GetInteger(), b, BigInteger::Base());
+    return BigInteger(std::vector<DataT>{r}, a.IsNegative());
+  }
+
+  bool IsDivisibleBy(BigInteger const &a, DataT b)
+  {
+    return Remainder(a.GetInteger(), b, BigInteger::Base()) == 0;
+  }
+
+  std::vector<DataT> RemaindersMod(BigInteger const &a, std::span<const DataT> divisors)
+  {
+    std::vector<DataT> r = ClassicDivision::Mod(a.GetInteger(), divisors, BigInteger::Base());
+    if (a.IsNegative())
+      for (SizeT j = 0; j < r.size(); ++j)
+        if (r[j] != 0)
+          r[j] = divisors[j] - r[j];
+    return r;
+  }
+
   BigInteger operator/(BigInteger const &a, DataT const &b) { return Divide(a, b); }
-  BigInteger operator%(BigInteger const &a, DataT const &b) { return DivideAndRemainder(a, b).second; }
+  BigInteger operator%(BigInteger const &a, DataT const &b) { return Remainder(a, b); }
 }
@@ -107,6 +107,28 @@ REGISTER_TEST(SquareCross, Mid_64)     { CrossSquare(64,   0x101); }
 REGISTER_TEST(SquareCross, Mid_256)    { CrossSquare(256,  0x102); }
 REGISTER_TEST(SquareCross, Large_1024) { CrossSquare(1024, 0x103); }
 
+// ─── wrap-around products: residue mod B^K − 1 ───────────────────────────────
+
+REGISTER_TEST(MulCross, WrapMatchesFoldedProduct)
+{
+  std::mt19937_64 gen(0x00B);
+  for (SizeT limbs : {SizeT{3}, SizeT{1000}, SizeT{4094}, SizeT{4096}})
+  {
+    SizeT K = NTTMultiplication::WrapLimbs(limbs, BigInteger::Base());
+    ASSERT_TRUE(K >= limbs);
+    auto a = RandomLimbs(limbs, gen);
+    auto b = RandomLimbs(K, gen);
+    for (auto &x : a) x |= (DataT)gen() & LimbMask;
+    for (auto &x : b) x = (DataT)gen() & LimbMask;
+    auto full = NTTMultiplication::FoldWrap(
+        ClassicMultiplication::Multiply(a, b, BigInteger::Base()), K, BigInteger::Base());
+    auto wrap = NTTMultiplication::MultiplyWrap(
+        NTTMultiplication::PrepareWrap(a, K, BigInteger::Base()), b);
+    ASSERT_EQ(wrap.size(), (size_t)K);
+    ASSERT_EQ(Compare(wrap, full), 0);
+  }
+}
+
 // ─── division: 5 algorithms agree ────────────────────────────────────────────
 
 static void CrossDiv(SizeT aLimbs, SizeT bLimbs, uint64_t seed)
@@ -171,6 +193,38 @@ REGISTER_TEST(DivCross, ScalarDivisor)
   ASSERT_EQ(Compare(dispatched.first, cq), 0);
 }
 
+// Newton with prepared spectra (divisor in the NTT band), against BZ, for
+// divisors at the edges of the normalized range: R = 2B^n exactly, and
+// R just above B^n.
+REGISTER_TEST(DivCross, NewtonEdgeDivisors)
+{
+  std::mt19937_64 gen(0x207);
+  const SizeT n = 2600;
+  std::vector<std::vector<DataT>> divisors(3, std::vector<DataT>(n, 0));
+  divisors[0].back() = (DataT)1 << (LimbBits - 1);
+  for (auto &x : divisors[1]) x = LimbMask;
+  for (auto &x : divisors[2]) x = (DataT)gen() & LimbMask;
+  divisors[2].back() |= 1;
+
+  for (auto const &b : divisors)
+  {
+    NewtonDivision::Divider divider(b, BigInteger::Base());
+    for (SizeT na : {n + 1, 2 * n, 2 * n + 1, 5 * n + 7})
+    {
+      std::vector<DataT> a(na);
+      for (auto &x : a) x = (DataT)gen() & LimbMask;
+      a.back() |= 1;
+      auto ref = BurnikelZieglerDivision::DivideAndRemainder(a, b, BigInteger::Base());
+      auto qr = divider.DivideAndRemainder(a);
+      ASSERT_EQ(Compare(qr.first, ref.first), 0);
+      ASSERT_EQ(Compare(qr.second, ref.second), 0);
+      auto nt = NewtonDivision::DivideAndRemainder(a, b, BigInteger::Base());
+      ASSERT_EQ(Compare(nt.first, ref.first), 0);
+      ASSERT_EQ(Compare(nt.second, ref.second), 0);
+    }
+  }
+}
+
 // ─── ReciprocalDivision: cached divisor reused across numerators ─────────────
 
 REGISTER_TEST(DivCross, ReciprocalReuseAcrossNumerators)
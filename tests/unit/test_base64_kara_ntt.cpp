@@ -124,3 +124,22 @@ REGISTER_TEST(Base64Ntt, KaratsubaVsNttAgree)
   auto n = NTTMultiplication::Multiply(a, b, Base2_64);
   ASSERT_TRUE(LimbVectorsEqual(k, n));
 }
+
+#if BIGMATH_NTT_MFA
+// The MFA (six-step) transform is only dispatched from 2^24 points, far
+// beyond a unit test; drive one level of it directly at the smallest size
+// that recurses.
+REGISTER_TEST(Base64Ntt, MfaRoundTrip)
+{
+  using namespace NttCrt;
+  Int n = 2 * BIGMATH_NTT_MFA_LEAF;
+  std::mt19937_64 gen(0x5EEDULL);
+  std::vector<UInt> orig(n), buf(n), scratch(n);
+  for (Int i = 0; i < n; ++i)
+    orig[i] = (UInt)(gen() % P1);
+  buf = orig;
+  ForwardMFA<F1, G1>(buf.data(), n, scratch.data(), false);
+  InverseMFA<F1, G1>(buf.data(), n, scratch.data(), false);
+  ASSERT_TRUE(buf == orig);
+}
+#endif
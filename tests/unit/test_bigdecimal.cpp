@@ -248,6 +248,13 @@ REGISTER_TEST(BigDecimal, SetScaleDown)
   ASSERT_EQ(S(D("1.2355").SetScale(3, RoundingMode::HALF_DOWN)), "1.235");
   ASSERT_EQ(S(D("1.2355").SetScale(3, RoundingMode::HALF_EVEN)), "1.236");
   ASSERT_EQ(S(D("1.2345").SetScale(3, RoundingMode::HALF_EVEN)), "1.234");
+  ASSERT_EQ(S(D("-1.2355").SetScale(3, RoundingMode::HALF_UP)),  "-1.236");
+  ASSERT_EQ(S(D("0.000").SetScale(1, RoundingMode::HALF_UP)),    "0.0");
+  // Drops of 19 and 20 digits, either side of the constant-divisor path.
+  ASSERT_EQ(S(D("3.1415926535897932384626433").SetScale(6, RoundingMode::HALF_UP)), "3.141593");
+  ASSERT_EQ(S(D("3.1415926535897932384626433").SetScale(5, RoundingMode::HALF_UP)), "3.14159");
+  ASSERT_EQ(S(D("123456789012345678901234567890.12345678901234567895").SetScale(1, RoundingMode::HALF_EVEN)),
+            "123456789012345678901234567890.1");
 }
 
 REGISTER_TEST(BigDecimal, StripTrailingZeros)
@@ -256,6 +263,10 @@ REGISTER_TEST(BigDecimal, StripTrailingZeros)
   ASSERT_EQ(S(D("100").StripTrailingZeros()),     "100");
   ASSERT_EQ(S(D("0").StripTrailingZeros()),       "0");
   ASSERT_EQ(S(D("1.5").StripTrailingZeros()),     "1.5");
+  ASSERT_EQ(S(D(("-12.34" + std::string(40, '0')).c_str()).StripTrailingZeros()), "-12.34");
+  ASSERT_EQ(S(D(("7." + std::string(9, '0')).c_str()).StripTrailingZeros()), "7");
+  ASSERT_EQ(S(D("0.1000000000010000000000").StripTrailingZeros()), "0.100000000001");
+  ASSERT_EQ(S(D(("0.12" + std::string(18, '0')).c_str()).StripTrailingZeros()), "0.12");
 }
 
 // ─── comparison ──────────────────────────────────────────────────────────────
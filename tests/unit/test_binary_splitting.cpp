@@ -0,0 +1,72 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/ops/BinarySplitting.h"
+#include "biginteger/ops/Comparison.h"
+
+using namespace BigMath;
+using bigmath_ut::Small;
+
+namespace
+{
+  BigInteger PowerOfTen(SizeT digits)
+  {
+    return BigIntegerBuilder::From("1" + std::string(digits, '0'));
+  }
+
+  // Σ sign^n / n!: p(n) = sign (p(0) = 1), q(n) = n (q(0) = 1), a = 1.
+  BinarySplitting::Generator ExpSeries(Long sign)
+  {
+    return [sign](ULong n) {
+      return BinarySplitting::Term{n == 0 ? Small(1) : BigIntegerBuilder::From(sign), Small(n == 0 ? 1 : n), Small(1)};
+    };
+  }
+}
+
+REGISTER_TEST(BinarySplitting, EulerNumber)
+{
+  auto r = BinarySplitting::Evaluate(ExpSeries(1), 0, 40);
+  BigInteger e = BinarySplitting::Quotient(r, PowerOfTen(40));
+  ASSERT_EQ(e.CompareTo(BigIntegerBuilder::From("27182818284590452353602874713526624977572")), 0);
+}
+
+REGISTER_TEST(BinarySplitting, AlternatingSeries)
+{
+  // 1/e = Σ (−1)^n / n!
+  auto r = BinarySplitting::Evaluate(ExpSeries(-1), 0, 40);
+  BigInteger inv = BinarySplitting::Quotient(r, PowerOfTen(40));
+  ASSERT_EQ(inv.CompareTo(BigIntegerBuilder::From("3678794411714423215955237701614608674458")), 0);
+}
+
+REGISTER_TEST(BinarySplitting, SplitPointDoesNotChangeResult)
+{
+  // P, Q, T are exact, so any tree shape (and the parallel subranges
+  // above BINARY_SPLITTING_PARALLEL_TERMS) gives the same integers.
+  ULong n = 3 * BinarySplitting::BINARY_SPLITTING_PARALLEL_TERMS / 2;
+  auto whole = BinarySplitting::Evaluate(ExpSeries(-1), 0, n, true);
+  auto left = BinarySplitting::Evaluate(ExpSeries(-1), 0, 7, true);
+  auto right = BinarySplitting::Evaluate(ExpSeries(-1), 7, n, true);
+  auto merged = BinarySplitting::Merge(left, right, true);
+  ASSERT_EQ(whole.P.CompareTo(merged.P), 0);
+  ASSERT_EQ(whole.Q.CompareTo(merged.Q), 0);
+  ASSERT_EQ(whole.T.CompareTo(merged.T), 0);
+}
+
+REGISTER_TEST(BinarySplitting, RejectsZeroDenominator)
+{
+  bool threw = false;
+  try
+  {
+    BinarySplitting::Evaluate([](ULong) { return BinarySplitting::Term{Small(1), Small(0), Small(1)}; }, 0, 4);
+  }
+  catch (std::invalid_argument const &)
+  {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
@@ -0,0 +1,150 @@
+#include "unit_test_framework.h"
+
+#include <random>
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/algorithms/Bitwise.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/ops/Bitwise.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Power.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+
+namespace
+{
+  BigInteger Signed(Long x)
+  {
+    return BigIntegerBuilder::From(x);
+  }
+
+  vector<Long> SmallValues()
+  {
+    vector<Long> values;
+    for (Long x = -70; x <= 70; ++x)
+      values.push_back(x);
+    for (Long x : {(Long)1 << 40, ((Long)1 << 62) - 1, (Long)0x5555555555555555, (Long)-0x123456789abcdef})
+    {
+      values.push_back(x);
+      values.push_back(-x);
+    }
+    return values;
+  }
+
+  BigInteger Big(ULong bits, ULong low)
+  {
+    return Pow(Signed(3), bits) + Signed((Long)low);
+  }
+}
+
+REGISTER_TEST(Bitwise, MatchesInt64)
+{
+  vector<Long> values = SmallValues();
+  for (Long x : values)
+  {
+    ASSERT_EQ((~Signed(x)).CompareTo(Signed(~x)), 0);
+    for (Long y : values)
+    {
+      ASSERT_EQ((Signed(x) & Signed(y)).CompareTo(Signed(x & y)), 0);
+      ASSERT_EQ((Signed(x) | Signed(y)).CompareTo(Signed(x | y)), 0);
+      ASSERT_EQ((Signed(x) ^ Signed(y)).CompareTo(Signed(x ^ y)), 0);
+    }
+  }
+}
+
+REGISTER_TEST(Bitwise, BitAccessMatchesInt64)
+{
+  for (Long x : SmallValues())
+  {
+    BigInteger a = Signed(x);
+    for (ULong i = 0; i < 63; ++i)
+    {
+      ASSERT_EQ(TestBit(a, i), ((x >> i) & 1) != 0);
+      ASSERT_EQ(SetBit(a, i).CompareTo(Signed(x | ((Long)1 << i))), 0);
+      ASSERT_EQ(ClearBit(a, i).CompareTo(Signed(x & ~((Long)1 << i))), 0);
+    }
+    // Sign extension above the magnitude.
+    ASSERT_EQ(TestBit(a, 1000), x < 0);
+    if (x != 0)
+      ASSERT_EQ(TrailingZeroBits(a), (ULong)__builtin_ctzll((ULong)x));
+    if (x >= 0)
+      ASSERT_EQ(PopCount(a), (ULong)__builtin_popcountll((ULong)x));
+  }
+}
+
+REGISTER_TEST(Bitwise, LargeIdentities)
+{
+  vector<BigInteger> values = {Big(500, 7), Big(1300, 0), Big(64, 1), Signed(0)};
+  SizeT count = values.size();
+  for (SizeT i = 0; i < count; ++i)
+    values.push_back(Signed(0) - values[i]);
+
+  for (BigInteger const &a : values)
+  {
+    ASSERT_EQ((~~a).CompareTo(a), 0);
+    ASSERT_EQ((a ^ a).CompareTo(Signed(0)), 0);
+    ASSERT_EQ((a & ~a).CompareTo(Signed(0)), 0);
+    ASSERT_EQ((a | ~a).CompareTo(Signed(-1)), 0);
+    for (BigInteger const &b : values)
+    {
+      // a + b = (a ^ b) + 2(a & b) and a | b = (a ^ b) + (a & b).
+      BigInteger x = a ^ b, n = a & b;
+      ASSERT_EQ((a + b).CompareTo(x + n + n), 0);
+      ASSERT_EQ((a | b).CompareTo(x + n), 0);
+      ASSERT_EQ((~(a & b)).CompareTo(~a | ~b), 0);
+    }
+  }
+}
+
+REGISTER_TEST(Bitwise, Counts)
+{
+  BigInteger m = Pow(Signed(2), 300) - Signed(1);
+  ASSERT_EQ(PopCount(m), (ULong)300);
+  ASSERT_EQ(BitLength(m), (ULong)300);
+  ASSERT_EQ(BitLength(Signed(0) - m), (ULong)300);
+  ASSERT_EQ(BitLength(Signed(0)), (ULong)0);
+  ASSERT_EQ(TrailingZeroBits(Pow(Signed(2), 777)), (ULong)777);
+  ASSERT_EQ(TrailingZeroBits(Signed(0)), ~(ULong)0);
+  ASSERT_EQ(PopCount(Signed(-1)), ~(ULong)0);
+
+  BigInteger a = Big(900, 5), b = Big(400, 11);
+  ASSERT_EQ(HammingDistance(a, b), PopCount(a ^ b));
+  ASSERT_EQ(HammingDistance(Signed(0) - a, Signed(0) - b), PopCount((Signed(0) - a) ^ (Signed(0) - b)));
+  ASSERT_EQ(HammingDistance(a, Signed(0) - b), ~(ULong)0);
+  ASSERT_EQ(HammingDistance(Signed(-5), Signed(-6)), (ULong)__builtin_popcountll((ULong)(-5 ^ -6)));
+}
+
+REGISTER_TEST(Bitwise, KernelsMatchLimbLoops)
+{
+  // Every length up to a few vector blocks, so each SIMD width meets a
+  // scalar tail of every size.
+  std::mt19937_64 gen(0xB17);
+  for (SizeT n = 0; n <= 40; ++n)
+  {
+    std::vector<DataT> a(n), b(n);
+    for (SizeT i = 0; i < n; ++i)
+    {
+      a[i] = (DataT)(gen() & LimbMask);
+      b[i] = (DataT)(gen() & LimbMask);
+    }
+    std::vector<DataT> rAnd = a, rOr = a, rXor = a, rNot = a;
+    AndTo(rAnd.data(), b.data(), n);
+    OrTo(rOr.data(), b.data(), n);
+    XorTo(rXor.data(), b.data(), n);
+    NotTo(rNot.data(), n);
+    ULong pop = 0, xorPop = 0;
+    for (SizeT i = 0; i < n; ++i)
+    {
+      ASSERT_EQ(rAnd[i], a[i] & b[i]);
+      ASSERT_EQ(rOr[i], a[i] | b[i]);
+      ASSERT_EQ(rXor[i], a[i] ^ b[i]);
+      ASSERT_EQ(rNot[i], ~a[i] & LimbMask);
+      pop += (ULong)__builtin_popcountll((ULong)a[i]);
+      xorPop += (ULong)__builtin_popcountll((ULong)(a[i] ^ b[i]));
+    }
+    ASSERT_EQ(PopCount(a.data(), n), pop);
+    ASSERT_EQ(XorPopCount(a.data(), b.data(), n), xorPop);
+  }
+}
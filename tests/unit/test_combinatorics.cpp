@@ -0,0 +1,99 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/ops/Combinatorics.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Division.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+using bigmath_ut::Small;
+
+namespace
+{
+  BigInteger NaiveFactorial(ULong n)
+  {
+    BigInteger r = Small(1);
+    for (ULong i = 2; i <= n; ++i)
+      r = r * Small(i);
+    return r;
+  }
+}
+
+REGISTER_TEST(Combinatorics, FactorialMatchesNaive)
+{
+  BigInteger naive = Small(1);
+  for (ULong n = 0; n <= 300; ++n)
+  {
+    if (n > 1)
+      naive = naive * Small(n);
+    ASSERT_EQ(Factorial(n).CompareTo(naive), 0);
+  }
+  ASSERT_EQ(Factorial(5000).CompareTo(NaiveFactorial(5000)), 0);
+  ASSERT_EQ(Factorial(20).CompareTo(BigIntegerBuilder::From("2432902008176640000")), 0);
+}
+
+REGISTER_TEST(Combinatorics, FactorialRecurrenceLarge)
+{
+  // Deep enough for NTT products in the tree and the final squares.
+  ULong n = 60000;
+  BigInteger f = Factorial(n);
+  ASSERT_EQ((Factorial(n - 1) * Small(n)).CompareTo(f), 0);
+  ASSERT_TRUE((f % Small(59999)).Zero());
+}
+
+REGISTER_TEST(Combinatorics, BinomialPascal)
+{
+  // k < n/4 cancels k! from the falling factorial, larger k sieve to n.
+  std::vector<BigInteger> row{Small(1)};
+  for (ULong n = 1; n <= 200; ++n)
+  {
+    std::vector<BigInteger> next(n + 1, Small(1));
+    for (ULong k = 1; k < n; ++k)
+      next[k] = row[k - 1] + row[k];
+    row = next;
+    for (ULong k = 0; k <= n; ++k)
+      ASSERT_EQ(Binomial(n, k).CompareTo(row[k]), 0);
+  }
+  ASSERT_TRUE(Binomial(10, 11).Zero());
+}
+
+REGISTER_TEST(Combinatorics, BinomialBothPaths)
+{
+  // C(n, k) = n! / (k!·(n − k)!), below and above the sieve ratio.
+  ULong n = 4000;
+  BigInteger fn = Factorial(n);
+  for (ULong k : {1, 7, 31, 62, 63, 64, 500, 1999, 2000, 3999})
+  {
+    BigInteger expected = fn / (Factorial(k) * Factorial(n - k));
+    ASSERT_EQ(Binomial(n, k).CompareTo(expected), 0);
+  }
+  // Falling factorial with 64-bit terms.
+  ULong big = 0xFFFFFFFFFFFFFFC5ULL;
+  BigInteger b = Small(big);
+  BigInteger expected = b * (b - Small(1)) * (b - Small(2)) / Small(6);
+  ASSERT_EQ(Binomial(big, 3).CompareTo(expected), 0);
+}
+
+REGISTER_TEST(Combinatorics, Primorial)
+{
+  ASSERT_EQ(Primorial(0).CompareTo(Small(1)), 0);
+  ASSERT_EQ(Primorial(1).CompareTo(Small(1)), 0);
+  ASSERT_EQ(Primorial(2).CompareTo(Small(2)), 0);
+  ASSERT_EQ(Primorial(30).CompareTo(Small(6469693230ULL)), 0);
+  ASSERT_EQ(Primorial(32).CompareTo(Small(200560490130ULL)), 0);
+
+  // Every prime ≤ 1000 divides 1000#, once.
+  BigInteger p = Primorial(1000);
+  for (ULong q : {2, 3, 5, 997})
+  {
+    ASSERT_TRUE((p % Small(q)).Zero());
+    ASSERT_FALSE(((p / Small(q)) % Small(q)).Zero());
+  }
+  ASSERT_FALSE((p % Small(991 * 991)).Zero());
+}
@@ -10,6 +10,11 @@
 
 #include "biginteger/BigInteger.h"
 #include "biginteger/algorithms/Division.h"
+#include "biginteger/algorithms/Shift.h"
+#include "biginteger/algorithms/division/ConstantDivision.h"
+#include "biginteger/algorithms/division/HenselDivision.h"
+#include "biginteger/algorithms/division/NewtonDivision.h"
+#include "biginteger/algorithms/modular/MontgomeryReduction.h"
 #include "biginteger/common/Builder.h"
 #include "biginteger/common/Comparator.h"
 #include "biginteger/common/Parser.h"
@@ -55,6 +60,9 @@ static void CheckRawIdentity(SizeT aLimbs, SizeT bLimbs, uint32_t seed)
 
   // r < b
   ASSERT_LT(Compare(r, b), 0);
+
+  // The remainder-only path runs the same band.
+  ASSERT_EQ(Compare(Remainder(a, b, BigInteger::Base()), r), 0);
 }
 
 // ─── single-limb divisor (scalar path) ───────────────────────────────────────
@@ -176,8 +184,334 @@ REGISTER_TEST(DivDispatch, NewtonBand_Skewed)
   // a much larger than b, with b above NEWTON_MEDIUM_B → Newton band.
   CheckRawIdentity(4096, 1100, 0x13);
 }
+REGISTER_TEST(DivDispatch, NewtonCachedUnnormalizedDoubleLength)
+{
+  // A 2n-limb a over an unnormalized n-limb b is 2n + 1 limbs after the
+  // shift, past R's precision as one block: it must go blockwise instead of
+  // overrunning the fixup and falling back to FastDivision.
+  std::mt19937_64 gen(0x2B1D);
+  SizeT n = 700;
+  std::vector<DataT> a(2 * n), b(n);
+  for (auto &x : a) x = (DataT)(gen() & LimbMask);
+  for (auto &x : b) x = (DataT)(gen() & LimbMask);
+  a.back() = LimbMask;
+  b.back() = 1;
+
+  NewtonDivision::Divider divider(b, BigInteger::Base());
+  auto qr = divider.DivideAndRemainder(a);
+
+  std::vector<DataT> back = Add(Multiply(qr.first, b, BigInteger::Base()), qr.second, BigInteger::Base());
+  ASSERT_EQ(Compare(back, a), 0);
+  ASSERT_LT(Compare(qr.second, b), 0);
+}
 REGISTER_TEST(DivDispatch, NewtonBand_VeryLarge)  { CheckRawIdentity(8192, 2048, 0x14); }
 REGISTER_TEST(DivDispatch, BZBand_AlmostBalanced) { CheckRawIdentity(1200, 1024, 0x15); }
+REGISTER_TEST(DivDispatch, BZBand_OddDivisor)     { CheckRawIdentity(2100, 1025, 0x16); }
+
+namespace
+{
+  // Latency mode planned for `workers` threads for one scope; the previous
+  // mode comes back even when an assertion throws.
+  struct LatencyScope
+  {
+    DivisionMode saved = GetDivisionMode();
+
+    explicit LatencyScope(SizeT workers)
+    {
+      SetDivisionMode(DivisionMode::Latency);
+      SetDivisionWorkers(workers);
+    }
+
+    ~LatencyScope()
+    {
+      SetDivisionWorkers(0);
+      SetDivisionMode(saved);
+    }
+  };
+}
+
+REGISTER_TEST(DivDispatch, LatencyModeMatchesThroughput)
+{
+  // BZ band, Newton medium-skew and high-skew bands. Planning for four
+  // workers splits BZ's q̂·b₀ products into slices and the high-skew Newton
+  // division into segments whatever the pool size.
+  struct Shape { SizeT a, b; uint32_t seed; };
+  for (Shape s : {Shape{4080, 2048, 0x17}, Shape{20000, 4096, 0x18}, Shape{24000, 2100, 0x19}})
+  {
+    std::mt19937_64 gen(s.seed);
+    std::vector<DataT> a(s.a), b(s.b);
+    for (auto &x : a) x = gen() & LimbMask;
+    for (auto &x : b) x = gen() & LimbMask;
+    a.back() |= 1;
+    b.back() |= 1;
+
+    auto serial = DivideAndRemainder(a, b, BigInteger::Base());
+    for (SizeT workers : {SizeT{0}, SizeT{4}})
+    {
+      LatencyScope latency(workers);
+      auto parallel = DivideAndRemainder(a, b, BigInteger::Base());
+      ASSERT_EQ(Compare(parallel.first, serial.first), 0);
+      ASSERT_EQ(Compare(parallel.second, serial.second), 0);
+      ASSERT_EQ(Compare(Remainder(a, b, BigInteger::Base()), serial.second), 0);
+    }
+  }
+  ASSERT_TRUE(GetDivisionMode() == DivisionMode::Throughput);
+}
+
+REGISTER_TEST(DivDispatch, TopLimbsMatchDivisor)
+{
+  // a = b·B^k − 1 = (b − 1)·B^k + B^k − 1: every quotient digit is B − 1
+  // and each step starts with the top two limbs equal to the divisor's.
+  for (SizeT nb : {3u, 40u, 1100u})
+  {
+    SizeT k = nb / 2 + 1;
+    std::vector<DataT> b(nb, 0);
+    b[0] = 5;
+    b[nb - 1] = (DataT)1 << (LimbBits - 1);
+    std::vector<DataT> r = b;
+    r[0] = 4;
+    std::vector<DataT> a(k, LimbMask);
+    a.insert(a.end(), r.begin(), r.end());
+
+    auto qr = DivideAndRemainder(a, b, BigInteger::Base());
+    ASSERT_EQ(Compare(qr.first, std::vector<DataT>(k, LimbMask)), 0);
+    ASSERT_EQ(Compare(qr.second, r), 0);
+  }
+}
+
+// ─── exact division ──────────────────────────────────────────────────────────
+
+// a = q·b·2^shift and b·2^shift must divide it back to q.
+static void CheckExact(SizeT qLimbs, SizeT bLimbs, ULong shift, uint32_t seed)
+{
+  std::mt19937_64 gen(seed);
+  std::vector<DataT> q(qLimbs), b(bLimbs);
+  for (auto &x : q) x = gen() & LimbMask;
+  for (auto &x : b) x = gen() & LimbMask;
+  if (q.back() == 0) q.back() = 1;
+  if (b.back() == 0) b.back() = 1;
+  b = ShiftLeftBits(b, shift);
+
+  std::vector<DataT> a = Multiply(q, b, BigInteger::Base());
+  ASSERT_EQ(Compare(DivExact(a, b, BigInteger::Base()), q), 0);
+}
+
+REGISTER_TEST(DivExact, Basecase)
+{
+  CheckExact(1, 1, 0, 0x20);
+  CheckExact(40, 1, 3, 0x21);
+  CheckExact(30, 30, 0, 0x22);
+  CheckExact(200, 7, 65, 0x23);
+}
+REGISTER_TEST(DivExact, Bidirectional)        { CheckExact(100, 100, 0, 0x24); CheckExact(300, 250, 130, 0x25); }
+REGISTER_TEST(DivExact, DivideAndConquer)     { CheckExact(1000, 400, 0, 0x26); CheckExact(60, 2000, 1, 0x27); }
+REGISTER_TEST(DivExact, NewtonInverse)        { CheckExact(16400, 8300, 5, 0x28); }
+
+REGISTER_TEST(DivExact, SignsAndZero)
+{
+  std::mt19937 gen(0xBBB);
+  std::string ad = RandomDigits(400, gen), bd = RandomDigits(150, gen);
+  BigInteger a = BigIntegerBuilder::From(ad), na = BigIntegerBuilder::From("-" + ad);
+  BigInteger b = BigIntegerBuilder::From(bd), nb = BigIntegerBuilder::From("-" + bd);
+  ASSERT_EQ(DivExact(a * b, b), a);
+  ASSERT_EQ(DivExact(na * b, b), na);
+  ASSERT_EQ(DivExact(a * nb, nb), a);
+  ASSERT_EQ(DivExact(a * b, nb), na);
+  ASSERT_TRUE(DivExact(BigInteger(), b).Zero());
+
+  bool threw = false;
+  try { (void)DivExact(a, BigInteger()); }
+  catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+// ─── Hensel division ─────────────────────────────────────────────────────────
+
+// q·b ≡ a (mod B^k), and r·B^k ≡ a (mod b) with r < b, for odd b.
+static void CheckHensel(SizeT aLimbs, SizeT bLimbs, SizeT k, uint32_t seed)
+{
+  std::mt19937_64 gen(seed);
+  std::vector<DataT> a(aLimbs), b(bLimbs);
+  for (auto &x : a) x = gen() & LimbMask;
+  for (auto &x : b) x = gen() & LimbMask;
+  if (a.back() == 0) a.back() = 1;
+  if (b.back() == 0) b.back() = 1;
+  b[0] |= 1;
+
+  std::vector<DataT> q = HenselDivision::Quotient(a, b, k);
+  ASSERT_EQ(q.size(), (size_t)k);
+  std::vector<DataT> qb = Multiply(q, b, BigInteger::Base());
+  qb.resize(std::max<size_t>(qb.size(), k), 0);
+  std::vector<DataT> aLow(a.begin(), a.begin() + std::min<size_t>(a.size(), k));
+  ASSERT_EQ(Compare(std::vector<DataT>(qb.begin(), qb.begin() + k), aLow), 0);
+
+  std::vector<DataT> r = HenselDivision::Reduce(a, b, k);
+  ASSERT_LT(Compare(r, b), 0);
+  ASSERT_EQ(Compare(Remainder(ShiftLeft(r, k), b, BigInteger::Base()),
+                    Remainder(a, b, BigInteger::Base())), 0);
+
+  HenselDivision::Divider divider(b, k);
+  ASSERT_EQ(Compare(divider.Quotient(a), q), 0);
+  ASSERT_EQ(Compare(divider.Reduce(a), r), 0);
+}
+
+REGISTER_TEST(Hensel, Basecase)
+{
+  CheckHensel(10, 1, 10, 0x30);
+  CheckHensel(40, 12, 28, 0x31);
+  CheckHensel(200, 30, 5, 0x32);
+}
+REGISTER_TEST(Hensel, DivideAndConquer)  { CheckHensel(1000, 400, 600, 0x33); CheckHensel(700, 600, 300, 0x34); }
+REGISTER_TEST(Hensel, NewtonInverse)     { CheckHensel(16800, 8300, 8500, 0x35); }
+
+// Montgomery's REDC: T·B^−n mod m for T < m·B^n.
+REGISTER_TEST(Hensel, ReduceIsRedc)
+{
+  std::mt19937_64 gen(0x36);
+  for (SizeT n : {SizeT{1}, SizeT{8}, SizeT{300}})
+  {
+    std::vector<DataT> m(n), x(n), y(n);
+    for (auto &v : m) v = gen() & LimbMask;
+    for (auto &v : x) v = gen() & LimbMask;
+    for (auto &v : y) v = gen() & LimbMask;
+    m[0] |= 1;
+    m.back() |= 1;
+    x = Remainder(x, m, BigInteger::Base());
+    y = Remainder(y, m, BigInteger::Base());
+    std::vector<DataT> t = Multiply(x, y, BigInteger::Base());
+    MontgomeryReduction::Context context(m);
+    ASSERT_EQ(Compare(HenselDivision::Reduce(t, m, n), context.Redc(t)), 0);
+  }
+
+  bool threw = false;
+  try { (void)HenselDivision::Reduce({1}, {2}, 1); }
+  catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+// ─── compile-time constant divisors ──────────────────────────────────────────
+
+template <ULong D>
+static void CheckConstant(std::mt19937_64 &gen)
+{
+  for (SizeT n : {(SizeT)1, (SizeT)2, (SizeT)5, (SizeT)300})
+  {
+    std::vector<DataT> a(n);
+    for (auto &x : a) x = gen() & LimbMask;
+    a.back() |= 1;
+
+    // Reference: D as a full-width operand of the dispatcher.
+    std::vector<DataT> d{(DataT)(D & LimbMask)};
+    if (LimbBits < 64 && (D >> (LimbBits % 64)) != 0)
+      d.push_back((DataT)(D >> (LimbBits % 64)));
+    TrimZerosToOne(d);
+    auto [q, r] = DivideAndRemainder(a, d, BigInteger::Base());
+    ULong rem = r[0] | (r.size() > 1 ? (ULong)r[1] << (LimbBits % 64) : 0);
+
+    std::vector<DataT> u = a;
+    ASSERT_EQ(ConstantDivider<D>::DivModTo(u), rem);
+    ASSERT_EQ(Compare(u, q), 0);
+    ASSERT_EQ(ConstantDivider<D>::Mod(a), rem);
+    ASSERT_EQ(ConstantDivider<D>::Divides(a), rem == 0);
+
+    std::vector<DataT> m = Multiply(q, d, BigInteger::Base());
+    ASSERT_TRUE(ConstantDivider<D>::Divides(m));
+    ConstantDivider<D>::DivideExactTo(m);
+    ASSERT_EQ(Compare(m, q), 0);
+  }
+}
+
+REGISTER_TEST(ConstantDivider, MatchesDispatcher)
+{
+  std::mt19937_64 gen(0xCD0);
+  CheckConstant<1>(gen);
+  CheckConstant<7>(gen);
+  CheckConstant<10>(gen);
+  CheckConstant<1000000000>(gen);
+  CheckConstant<1000000000000000000ULL>(gen);
+  CheckConstant<Base10_19>(gen);
+  CheckConstant<(ULong)1 << 40>(gen);
+  CheckConstant<~(ULong)0>(gen);
+}
+
+// ─── remainder and divisibility ──────────────────────────────────────────────
+
+REGISTER_TEST(Remainder, ScalarMatchesDivide)
+{
+  std::mt19937 gen(0xCCC);
+  for (DataT d : {(DataT)1, (DataT)3, (DataT)10, (DataT)0x80000001, LimbMask})
+  {
+    BigInteger a = BigIntegerBuilder::From(RandomDigits(500, gen));
+    auto [q, r] = DivideAndRemainder(a, d);
+    ASSERT_EQ(Remainder(a, d), r);
+    ASSERT_EQ(a % d, r);
+    ASSERT_EQ(IsDivisibleBy(a, d), r.Zero());
+    ASSERT_TRUE(IsDivisibleBy(q * BigIntegerBuilder::From((ULong)d), d));
+  }
+}
+
+REGISTER_TEST(Remainder, ManySingleLimbDivisors)
+{
+  std::mt19937_64 gen(0xCCF);
+  std::vector<DataT> divisors = {1, 2, 3, 7, LimbMask, LimbMask / 5, LimbMask / 5 + 1};
+  for (int i = 0; i < 60; ++i)
+    divisors.push_back(((DataT)(gen() >> (i % 60)) & LimbMask) | 1);
+  for (SizeT n : {(SizeT)1, (SizeT)7, (SizeT)600})
+  {
+    std::vector<DataT> v(n);
+    for (auto &x : v) x = gen() & LimbMask;
+    v.back() |= 1;
+    BigInteger a(v, false), na(v, true);
+    std::vector<DataT> r = RemaindersMod(a, divisors), nr = RemaindersMod(na, divisors);
+    for (SizeT j = 0; j < divisors.size(); ++j)
+    {
+      ASSERT_EQ(BigInteger(std::vector<DataT>{r[j]}, false), a % divisors[j]);
+      ASSERT_EQ((r[j] + nr[j]) % divisors[j], (DataT)0);
+      ASSERT_LT(nr[j], divisors[j]);
+    }
+  }
+
+  divisors.push_back(0);
+  bool threw = false;
+  try { (void)RemaindersMod(BigIntegerBuilder::From("5"), divisors); }
+  catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+REGISTER_TEST(Remainder, SignFollowsOperator)
+{
+  std::mt19937 gen(0xCCD);
+  std::string ad = RandomDigits(300, gen), bd = RandomDigits(90, gen);
+  BigInteger a = BigIntegerBuilder::From(ad), na = BigIntegerBuilder::From("-" + ad);
+  BigInteger b = BigIntegerBuilder::From(bd), nb = BigIntegerBuilder::From("-" + bd);
+  for (BigInteger const &x : {a, na})
+    for (BigInteger const &y : {b, nb})
+      ASSERT_EQ(Remainder(x, y), DivideAndRemainder(x, y).second);
+}
+
+REGISTER_TEST(IsDivisibleBy, MultiplesAndNeighbours)
+{
+  std::mt19937 gen(0xCCE);
+  BigInteger one = BigIntegerBuilder::From("1");
+  BigInteger two = BigIntegerBuilder::From("2");
+  for (int digits : {20, 400, 3000})
+  {
+    BigInteger q = BigIntegerBuilder::From(RandomDigits(digits, gen));
+    BigInteger b = BigIntegerBuilder::From(RandomDigits(digits / 2 + 1, gen));
+    BigInteger even = b * two * two;
+    ASSERT_TRUE(IsDivisibleBy(q * b, b));
+    ASSERT_TRUE(IsDivisibleBy(q * even, even));
+    ASSERT_FALSE(IsDivisibleBy(q * b + one, b));
+    ASSERT_FALSE(IsDivisibleBy(q * even + b, even));
+    ASSERT_FALSE(IsDivisibleBy(b, q * b));
+  }
+  ASSERT_TRUE(IsDivisibleBy(BigInteger(), two));
+
+  bool threw = false;
+  try { (void)IsDivisibleBy(two, BigInteger()); }
+  catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
 
 // ─── multiplicative round-trip on the public API ─────────────────────────────
 
@@ -51,6 +51,20 @@ REGISTER_TEST(Eval, Power)
   ASSERT_EQ(EvalDec("2^3^2"),      "512");   // right-assoc: 2^(3^2)
   ASSERT_EQ(EvalDec("(-2)^3"),     "-8");
   ASSERT_EQ(EvalDec("3 * 2^4"),    "48");    // ^ tighter than *
+  ASSERT_EQ(EvalDec("1^(10^40)"),  "1");     // exponent past 64 bits
+  ASSERT_EQ(EvalDec("(-1)^(10^40+1)"), "-1");
+  ASSERT_EQ(EvalDec("0^(2^70)"),   "0");
+}
+
+REGISTER_TEST(Eval, Factorial)
+{
+  ASSERT_EQ(EvalDec("0!"),         "1");
+  ASSERT_EQ(EvalDec("5!"),         "120");
+  ASSERT_EQ(EvalDec("3!!"),        "720");
+  ASSERT_EQ(EvalDec("-3!"),        "-6");    // ! tighter than unary minus
+  ASSERT_EQ(EvalDec("2^3!"),       "64");
+  ASSERT_EQ(EvalDec("(2+3)! / 4!"), "5");
+  ASSERT_EQ(EvalDec("25!"),        "15511210043330985984000000");
 }
 
 REGISTER_TEST(Eval, Modulo)
@@ -143,6 +157,18 @@ REGISTER_TEST(Eval, ErrorNegativeExponent)
   ASSERT_TRUE(threw);
 }
 
+REGISTER_TEST(Eval, ErrorNegativeFactorial)
+{
+  ExpressionEvaluator e;
+  bool threw = false;
+  try { (void)e.Eval("(0 - 3)!"); }
+  catch (EvalError const &ex) {
+    threw = true;
+    ASSERT_EQ(ex.Position(), 7);       // caret at '!'
+  }
+  ASSERT_TRUE(threw);
+}
+
 REGISTER_TEST(Eval, ErrorTrailingJunk)
 {
   ExpressionEvaluator e;
@@ -0,0 +1,183 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/common/Parser.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Division.h"
+#include "biginteger/ops/Gcd.h"
+#include "biginteger/ops/Modular.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+using bigmath_ut::RandomLimbs;
+using bigmath_ut::Small;
+
+namespace
+{
+  // Limbs drawn from {0, B − 1, random}: long runs of zero and all-ones
+  // limbs drive Lehmer rounds that accept exactly one step.
+  BigInteger StructuredLimbs(SizeT n, RandomGenerator &gen)
+  {
+    std::vector<DataT> v(n);
+    for (DataT &x : v)
+    {
+      ULong r = gen.Next();
+      x = r % 3 == 0 ? 0 : r % 3 == 1 ? LimbMask : (DataT)(gen.Next() & LimbMask);
+    }
+    if (v.back() == 0)
+      v.back() = 1;
+    return BigInteger(v, false);
+  }
+
+  // g = gcd(a, b), s·a + t·b = g, and g divides both.
+  void CheckExtended(BigInteger const &a, BigInteger const &b)
+  {
+    BigInteger s, t;
+    BigInteger g = ExtendedGcd(a, b, s, t);
+    ASSERT_EQ(g.CompareTo(Gcd(a, b)), 0);
+    ASSERT_EQ((s * a + t * b).CompareTo(g), 0);
+    if (!g.Zero())
+    {
+      ASSERT_TRUE((a % g).Zero());
+      ASSERT_TRUE((b % g).Zero());
+    }
+  }
+}
+
+REGISTER_TEST(Gcd, SmallValues)
+{
+  ASSERT_EQ(Gcd(Small(12), Small(18)).CompareTo(Small(6)), 0);
+  ASSERT_EQ(Gcd(Small(17), Small(5)).CompareTo(Small(1)), 0);
+  ASSERT_EQ(Gcd(Small(0), Small(9)).CompareTo(Small(9)), 0);
+  ASSERT_EQ(Gcd(Small(9), Small(0)).CompareTo(Small(9)), 0);
+  ASSERT_TRUE(Gcd(Small(0), Small(0)).Zero());
+}
+
+REGISTER_TEST(Gcd, IgnoresSigns)
+{
+  BigInteger a = Small(84).SetSign(true);
+  BigInteger b = Small(36);
+  ASSERT_EQ(Gcd(a, b).CompareTo(Small(12)), 0);
+  ASSERT_FALSE(Gcd(a, Small(36).SetSign(true)).IsNegative());
+  CheckExtended(a, b);
+  CheckExtended(b, a);
+  CheckExtended(Small(0), a);
+}
+
+REGISTER_TEST(Gcd, KnownFactorAcrossSizes)
+{
+  // a = f·x, b = f·y: f divides the GCD on every path (binary, Lehmer,
+  // half-GCD with and without the recursive top part).
+  RandomGenerator gen(0x6CD6CD);
+  for (SizeT n : {SizeT{2}, SizeT{5}, SizeT{40}, SizeT{200},
+                  HalfGcd::GCD_HGCD_THRESHOLD + 80, SizeT{2000}})
+  {
+    BigInteger f = RandomLimbs(n / 4 + 1, gen, true);
+    BigInteger a = f * RandomLimbs(n, gen, true);
+    BigInteger b = f * RandomLimbs(n - n / 8, gen, true);
+    BigInteger g = Gcd(a, b);
+    ASSERT_TRUE((g % f).Zero());
+    CheckExtended(a, b);
+    CheckExtended(b, a);
+  }
+}
+
+REGISTER_TEST(Gcd, StructuredLimbs)
+{
+  BigInteger a = ParseHex("800000ffffffffffffffff0000000000000000");
+  BigInteger b = ParseHex("1000000000000000000b75e7063fa7027ce");
+  ASSERT_EQ(Gcd(a, b).CompareTo(Small(22)), 0);
+  CheckExtended(a, b);
+  CheckExtended(b, a);
+
+  RandomGenerator gen(0x6CD6CF);
+  for (int i = 0; i < 400; ++i)
+  {
+    SizeT n = 2 + (SizeT)(gen.Next() % 40);
+    BigInteger x = StructuredLimbs(n, gen);
+    BigInteger y = StructuredLimbs(1 + (SizeT)(gen.Next() % n), gen);
+    CheckExtended(x, y);
+  }
+}
+
+REGISTER_TEST(Gcd, ConsecutiveFibonacciAreCoprime)
+{
+  // The worst case for Euclid: every quotient is 1.
+  BigInteger a = Small(1), b = Small(1);
+  for (int i = 0; i < 30000; ++i)
+  {
+    BigInteger c = a + b;
+    a = b;
+    b = c;
+  }
+  ASSERT_EQ(Gcd(b, a).CompareTo(Small(1)), 0);
+  CheckExtended(b, a);
+}
+
+REGISTER_TEST(Gcd, ModInverse)
+{
+  RandomGenerator gen(0x6CD6CE);
+  ASSERT_EQ(ModInverse(Small(3), Small(7)).CompareTo(Small(5)), 0);
+  ASSERT_EQ(ModInverse(Small(3).SetSign(true), Small(7)).CompareTo(Small(2)), 0);
+  for (SizeT n : {SizeT{3}, SizeT{500}})
+  {
+    BigInteger m = RandomLimbs(n, gen, true);
+    BigInteger a = RandomLimbs(n + 2, gen, true);
+    while (Gcd(a, m).CompareTo(Small(1)) != 0)
+      a = a + Small(1);
+    BigInteger x = ModInverse(a, m);
+    ASSERT_FALSE(x.IsNegative());
+    ASSERT_TRUE(x.CompareTo(m) < 0);
+    ASSERT_EQ(((a * x) % m).CompareTo(Small(1)), 0);
+  }
+}
+
+REGISTER_TEST(Gcd, ModInverseStructuredLimbs)
+{
+  // The Gcd.StructuredLimbs pair divided by its GCD of 22.
+  BigInteger a = ParseHex("800000ffffffffffffffff0000000000000000") / Small(22);
+  BigInteger m = ParseHex("1000000000000000000b75e7063fa7027ce") / Small(22);
+  ASSERT_EQ(((a * ModInverse(a, m)) % m).CompareTo(Small(1)), 0);
+  ASSERT_EQ(((m * ModInverse(m, a)) % a).CompareTo(Small(1)), 0);
+
+  BigInteger x = ParseHex("1ffffffffffffffff0000000000000000ffffffffffffffff");
+  BigInteger y = ParseHex("ffffffffffffffff00000000000000000000000000000000ffffffffffffffff");
+  ASSERT_EQ(((x * ModInverse(x, y)) % y).CompareTo(Small(1)), 0);
+  ASSERT_EQ(((y * ModInverse(y, x)) % x).CompareTo(Small(1)), 0);
+
+  RandomGenerator gen(0x6CD6D0);
+  for (int i = 0; i < 200; ++i)
+  {
+    SizeT n = 2 + (SizeT)(gen.Next() % 8);
+    BigInteger u = StructuredLimbs(n, gen);
+    BigInteger mod = StructuredLimbs(1 + (SizeT)(gen.Next() % n), gen);
+    if (mod.CompareTo(Small(1)) <= 0 || Gcd(u, mod).CompareTo(Small(1)) != 0)
+      continue;
+    BigInteger inv = ModInverse(u, mod);
+    ASSERT_FALSE(inv.IsNegative());
+    ASSERT_TRUE(inv.CompareTo(mod) < 0);
+    ASSERT_EQ(((u * inv) % mod).CompareTo(Small(1)), 0);
+  }
+}
+
+REGISTER_TEST(Gcd, ModInverseRejectsSharedFactor)
+{
+  bool threw = false;
+  try { (void)ModInverse(Small(6), Small(9)); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+  threw = false;
+  try { (void)ModInverse(Small(6), Small(0)); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+REGISTER_TEST(Gcd, ModPowNegativeExponent)
+{
+  // 3^-2 ≡ 4^2 = 16 ≡ 5 (mod 11) and 3^-1 ≡ 5 (mod 14).
+  ASSERT_EQ(ModPow(Small(3), Small(2).SetSign(true), Small(11)).CompareTo(Small(5)), 0);
+  ASSERT_EQ(ModPow(Small(3), Small(1).SetSign(true), Small(14)).CompareTo(Small(5)), 0);
+}
@@ -0,0 +1,172 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/ops/Division.h"
+#include "biginteger/ops/Modular.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+using bigmath_ut::RandomOdd;
+using bigmath_ut::Small;
+
+namespace
+{
+  // 2^bits - 1
+  BigInteger Mersenne(SizeT bits)
+  {
+    std::vector<DataT> v(bits / LimbBits, (DataT)LimbMask);
+    if (bits % LimbBits)
+      v.push_back((DataT)(((ULong)1 << (bits % LimbBits)) - 1));
+    return BigInteger(v, false);
+  }
+}
+
+REGISTER_TEST(Montgomery, ModMulMatchesDivision)
+{
+  RandomGenerator gen(0x30D30D);
+  // Word REDC below BIGMATH_MONTGOMERY_BLOCK_THRESHOLD, block REDC above.
+  SizeT block = MontgomeryReduction::MONTGOMERY_BLOCK_THRESHOLD;
+  for (SizeT limbs : {SizeT{1}, SizeT{2}, SizeT{7}, SizeT{63}, block - 1, block})
+  {
+    BigInteger m = RandomOdd(limbs, gen);
+    MontgomeryContext ctx(m);
+    for (int trial = 0; trial < 2; ++trial)
+    {
+      BigInteger a = RandomOdd(limbs + 1, gen) % m;
+      BigInteger b = RandomOdd(limbs, gen) % m;
+      ASSERT_EQ(ctx.ModMul(a, b).CompareTo((a * b) % m), 0);
+      ASSERT_EQ(ctx.ModSqr(a).CompareTo((a * a) % m), 0);
+      ASSERT_EQ(ctx.FromMontgomery(ctx.ToMontgomery(a)).CompareTo(a), 0);
+    }
+  }
+}
+
+REGISTER_TEST(Montgomery, PreparedModulusMatchesDivision)
+{
+  RandomGenerator gen(0x30D30E);
+  SizeT limbs = MontgomeryReduction::MONTGOMERY_PREPARED_THRESHOLD + 8;
+  BigInteger m = RandomOdd(limbs, gen);
+  MontgomeryContext ctx(m);
+  BigInteger a = RandomOdd(limbs, gen) % m;
+  BigInteger b = RandomOdd(limbs - 3, gen);
+  ASSERT_EQ(ctx.ModMul(a, b).CompareTo((a * b) % m), 0);
+}
+
+REGISTER_TEST(Montgomery, ModPowMatchesRepeatedMultiply)
+{
+  for (DataT mod : {DataT{1000003}, DataT{1000000}, DataT{97}, DataT{1}})
+  {
+    BigInteger m = Small(mod);
+    BigInteger base = Small(123457);
+    BigInteger expected = Small(1) % m;
+    for (DataT e = 0; e < 70; ++e)
+    {
+      ASSERT_EQ(ModPow(base, Small(e), m).CompareTo(expected), 0);
+      expected = (expected * base) % m;
+    }
+  }
+}
+
+REGISTER_TEST(Montgomery, BlockPowerLawHolds)
+{
+  // a^(e1+e2) ≡ a^e1 · a^e2 on a block-REDC modulus.
+  RandomGenerator gen(0x30D30F);
+  BigInteger m = RandomOdd(MontgomeryReduction::MONTGOMERY_BLOCK_THRESHOLD + 5, gen);
+  MontgomeryContext ctx(m);
+  BigInteger a = RandomOdd(40, gen);
+  BigInteger e1 = RandomOdd(1, gen);
+  BigInteger e2 = RandomOdd(2, gen);
+  BigInteger lhs = ctx.ModPow(a, e1 + e2);
+  BigInteger rhs = ctx.ModMul(ctx.ModPow(a, e1), ctx.ModPow(a, e2));
+  ASSERT_EQ(lhs.CompareTo(rhs), 0);
+}
+
+REGISTER_TEST(Montgomery, FermatOnMersennePrimes)
+{
+  // 3^(p-1) ≡ 1 (mod p) for the primes M127 and M4423.
+  for (SizeT bits : {SizeT{127}, SizeT{4423}})
+  {
+    BigInteger p = Mersenne(bits);
+    BigInteger pm1 = p - Small(1);
+    ASSERT_EQ(ModPow(Small(3), pm1, p).CompareTo(Small(1)), 0);
+    // Composite neighbour fails the same test.
+    BigInteger q = p - Small(2);
+    ASSERT_NE(ModPow(Small(3), q - Small(1), q).CompareTo(Small(1)), 0);
+  }
+}
+
+REGISTER_TEST(Montgomery, NegativeBaseReducesIntoRange)
+{
+  // (-7)^13 = -96889010407 ≡ 593 (mod 1000), ≡ 1000003 - 9010407 % 1000003 (mod 1000003).
+  BigInteger a = Small(7).SetSign(true);
+  ASSERT_EQ(ModPow(a, Small(13), Small(1000)).CompareTo(Small(593)), 0);
+  BigInteger odd = Small(1000003);
+  BigInteger expected = odd - (Small(96889010407ULL % 1000003));
+  ASSERT_EQ(ModPow(a, Small(13), odd).CompareTo(expected), 0);
+}
+
+REGISTER_TEST(Montgomery, RejectsEvenModulus)
+{
+  bool threw = false;
+  try { MontgomeryContext ctx(Small(10)); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+  threw = false;
+  try { (void)ModPow(Small(2), Small(3), Small(0)); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+REGISTER_TEST(Barrett, ReduceMatchesRemainder)
+{
+  RandomGenerator gen(0xBA77E7);
+  SizeT ntt = (SizeT)NTT_MULTIPLICATION_THRESHOLD / 2;
+  for (SizeT k : {SizeT{1}, SizeT{2}, SizeT{5}, SizeT{48}, SizeT{49}, SizeT{200}, ntt})
+  {
+    BigInteger m = RandomOdd(k, gen);
+    BarrettReducer reducer(m);
+    for (SizeT xl : {SizeT{1}, k, k + 1, 2 * k - 1, 2 * k, 2 * k + 3})
+    {
+      BigInteger x = RandomOdd(std::max(xl, SizeT{1}), gen);
+      ASSERT_EQ(reducer.Reduce(x).CompareTo(x % m), 0);
+    }
+    // Extremes of the Barrett domain: m² − 1 and B^2k − 1.
+    BigInteger sq = m * m - Small(1);
+    ASSERT_EQ(reducer.Reduce(sq).CompareTo(sq % m), 0);
+    BigInteger top = Mersenne(2 * k * LimbBits);
+    ASSERT_EQ(reducer.Reduce(top).CompareTo(top % m), 0);
+    ASSERT_EQ(reducer.Reduce(m).CompareTo(Small(0)), 0);
+  }
+}
+
+REGISTER_TEST(Barrett, SignFollowsRemainderOperator)
+{
+  BigInteger m = Small(1000003);
+  BarrettReducer reducer(m);
+  // Built from one-limb factors so it also fits 32-bit limbs.
+  BigInteger x = Small(96889) * Small(1000003) + Small(12345);
+  x.SetSign(true);
+  ASSERT_EQ(reducer.Reduce(x).CompareTo(x % m), 0);
+  ASSERT_TRUE(reducer.Reduce(x).IsNegative());
+}
+
+REGISTER_TEST(Barrett, ReusedOutputVectorKeepsCapacity)
+{
+  RandomGenerator gen(0xBA77E8);
+  BigInteger m = RandomOdd(64, gen);
+  BarrettReduction::Reducer reducer(m.GetInteger());
+  std::vector<DataT> r;
+  r.reserve(65);
+  const DataT *storage = r.data();
+  for (int i = 0; i < 8; ++i)
+  {
+    BigInteger x = RandomOdd(127, gen);
+    reducer.Reduce(x.GetInteger(), r);
+    ASSERT_EQ(BigInteger(r, false).CompareTo(x % m), 0);
+    ASSERT_TRUE(r.data() == storage);
+  }
+}
@@ -11,6 +11,8 @@
 #include "biginteger/BigInteger.h"
 #include "biginteger/algorithms/Multiplication.h"
 #include "biginteger/algorithms/multiplication/ClassicMultiplication.h"
+#include "biginteger/algorithms/multiplication/CombaMultiplication.h"
+#include "biginteger/algorithms/multiplication/KaratsubaMultiplication.h"
 #include "biginteger/common/Builder.h"
 #include "biginteger/common/Parser.h"
 #include "biginteger/ops/Addition.h"
@@ -172,6 +174,30 @@ REGISTER_TEST(MulDispatch, AsymmetricSizes)
   ASSERT_EQ(Compare(dispatched, classic), 0);
 }
 
+REGISTER_TEST(MulKaratsuba, SkewedShapesStayInWorkspace)
+{
+  // Operands far apart in length are sliced into balanced pieces; recursing
+  // on the raw split used to run past the 16n workspace (e.g. 65×1000).
+  std::mt19937_64 gen(0x5CE3);
+  for (SizeT la : {SizeT{33}, SizeT{65}, SizeT{300}})
+    for (SizeT lb : {SizeT{1000}, SizeT{1001}, SizeT{2 * la}, SizeT{2 * la - 1}})
+    {
+      std::vector<DataT> a(la), b(lb);
+      for (auto &x : a)
+        x = (DataT)(gen() & LimbMask);
+      for (auto &x : b)
+        x = (DataT)(gen() & LimbMask);
+      std::vector<DataT> kara = KaratsubaMultiplication::Multiply(a, b, BigInteger::Base());
+      std::vector<DataT> classic = ClassicMultiplication::Multiply(a, b, BigInteger::Base());
+      TrimZeros(kara);
+      TrimZeros(classic);
+      ASSERT_EQ(Compare(kara, classic), 0);
+      kara = KaratsubaMultiplication::Multiply(b, a, BigInteger::Base());
+      TrimZeros(kara);
+      ASSERT_EQ(Compare(kara, classic), 0);
+    }
+}
+
 REGISTER_TEST(MulDispatch, ScalarFastPath)
 {
   // Single-limb b operand should route through the scalar dispatcher path.
@@ -181,3 +207,46 @@ REGISTER_TEST(MulDispatch, ScalarFastPath)
   std::vector<DataT> classic = ClassicMultiplication::Multiply(a, b, BigInteger::Base());
   ASSERT_EQ(Compare(dispatched, classic), 0);
 }
+
+// ─── small-shape Comba kernels ───────────────────────────────────────────────
+// Every shape in the 8×8 kernel table must match the row-wise schoolbook loop,
+// including the all-ones operands that drive the column carry word to its max.
+
+static std::vector<DataT> RowWiseProduct(std::vector<DataT> const &a, std::vector<DataT> const &b)
+{
+  std::vector<DataT> r(a.size() + b.size() + 1, 0);
+  ClassicMultiplication::Multiply(a, 0, (SizeT)a.size() - 1, b, 0, (SizeT)b.size() - 1, r, 0, BigInteger::Base());
+  TrimZeros(r);
+  return r;
+}
+
+#if BIGMATH_LIMB_64
+REGISTER_TEST(MulComba, AllShapesMatchRowWise)
+{
+  std::mt19937_64 gen(0xC0BA);
+  for (SizeT na = 1; na <= CombaMultiplication::COMBA_MAX_LIMBS; ++na)
+  {
+    for (SizeT nb = 1; nb <= CombaMultiplication::COMBA_MAX_LIMBS; ++nb)
+    {
+      std::vector<DataT> a(na), b(nb);
+      for (auto &x : a) x = gen();
+      for (auto &x : b) x = gen();
+      a.back() |= 1;
+      b.back() |= 1;
+      ASSERT_EQ(Compare(ClassicMultiplication::Multiply(a, b, BigInteger::Base()), RowWiseProduct(a, b)), 0);
+    }
+  }
+}
+
+REGISTER_TEST(MulComba, MaxCarryAllShapes)
+{
+  for (SizeT na = 1; na <= CombaMultiplication::COMBA_MAX_LIMBS; ++na)
+  {
+    for (SizeT nb = 1; nb <= CombaMultiplication::COMBA_MAX_LIMBS; ++nb)
+    {
+      std::vector<DataT> a(na, ~(DataT)0), b(nb, ~(DataT)0);
+      ASSERT_EQ(Compare(ClassicMultiplication::Multiply(a, b, BigInteger::Base()), RowWiseProduct(a, b)), 0);
+    }
+  }
+}
+#endif
@@ -0,0 +1,42 @@
+// Thread pool dispatch: state left behind by ParallelFor / ParallelDo.
+
+#include "unit_test_framework.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+#include "biginteger/common/Parallel.h"
+
+using namespace BigMath;
+
+#if BIGMATH_USE_THREADS
+REGISTER_TEST(Parallel, ThrowingChunkLeavesParallelRegion)
+{
+  // The caller runs chunk 0 itself and is marked as inside a parallel
+  // region meanwhile. A throw there must clear the mark, or every later
+  // dispatch from this thread would run serially.
+  Int tasks = (Int)ParallelNumThreads();
+  bool threw = false;
+  try
+  {
+    ParallelDo(tasks, [](Int start, Int) {
+      if (start == 0)
+        throw std::runtime_error("chunk 0");
+    });
+  }
+  catch (std::runtime_error const &)
+  {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+
+  std::thread::id caller = std::this_thread::get_id();
+  std::atomic<int> offCaller{0};
+  ParallelDo(tasks, [&](Int, Int) {
+    if (std::this_thread::get_id() != caller)
+      ++offCaller;
+  });
+  ASSERT_EQ(offCaller.load() > 0, tasks > 1);
+}
+#endif
@@ -0,0 +1,85 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Power.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+using bigmath_ut::RandomLimbs;
+using bigmath_ut::Small;
+
+namespace
+{
+  BigInteger NaivePow(BigInteger const &a, ULong e)
+  {
+    BigInteger r = Small(1);
+    for (ULong i = 0; i < e; ++i)
+      r = r * a;
+    return r;
+  }
+}
+
+REGISTER_TEST(Power, SmallValues)
+{
+  ASSERT_EQ(Pow(Small(0), 0).CompareTo(Small(1)), 0);
+  ASSERT_TRUE(Pow(Small(0), 5).Zero());
+  ASSERT_EQ(Pow(Small(1), 1000000).CompareTo(Small(1)), 0);
+  ASSERT_EQ(Pow(Small(3), 40).CompareTo(BigIntegerBuilder::From("12157665459056928801")), 0);
+  ASSERT_EQ(Pow(Small(10), 25).CompareTo(BigIntegerBuilder::From("10000000000000000000000000")), 0);
+  for (DataT a = 2; a < 40; ++a)
+    for (ULong e = 0; e < 70; ++e)
+      ASSERT_EQ(Pow(Small(a), e).CompareTo(NaivePow(Small(a), e)), 0);
+}
+
+REGISTER_TEST(Power, Signs)
+{
+  BigInteger minusThree = Small(0) - Small(3);
+  ASSERT_EQ(Pow(minusThree, 3).CompareTo(Small(0) - Small(27)), 0);
+  ASSERT_EQ(Pow(minusThree, 4).CompareTo(Small(81)), 0);
+  ASSERT_EQ(Pow(minusThree, 0).CompareTo(Small(1)), 0);
+}
+
+REGISTER_TEST(Power, PowersOfTwoAreShifts)
+{
+  // 2^e and 12^e = 3^e·2^(2e) across limb boundaries.
+  for (ULong e : {1, 31, 32, 63, 64, 65, 1000, 100003})
+  {
+    std::vector<DataT> v(e / LimbBits + 1, 0);
+    v.back() = (DataT)1 << (e % LimbBits);
+    ASSERT_EQ(Pow(Small(2), e).CompareTo(BigInteger(v, false)), 0);
+  }
+  ASSERT_EQ(Pow(Small(12), 300).CompareTo(NaivePow(Small(12), 300)), 0);
+  std::vector<DataT> v{0, 0, 6};
+  ASSERT_EQ(Pow(BigInteger(v, false), 7).CompareTo(NaivePow(BigInteger(v, false), 7)), 0);
+}
+
+REGISTER_TEST(Power, MultiLimbBases)
+{
+  RandomGenerator gen(4);
+  for (SizeT limbs : {2, 5, 40})
+    for (ULong e : {2, 3, 17, 100})
+    {
+      BigInteger a = RandomLimbs(limbs, gen, true);
+      ASSERT_EQ(Pow(a, e).CompareTo(NaivePow(a, e)), 0);
+    }
+
+  // Windowed once the result is in the NTT band (10-bit exponents here).
+  BigInteger a = RandomLimbs(8, gen, true);
+  BigInteger a250 = Pow(a, 250);
+  ASSERT_EQ(Pow(a, 1000).CompareTo(Pow(Pow(a250, 2), 2)), 0);
+  ASSERT_EQ(Pow(a, 1001).CompareTo(Pow(a, 1000) * a), 0);
+  ASSERT_EQ(Pow(a, 1003).CompareTo(Pow(a, 1001) * a * a), 0);
+}
+
+REGISTER_TEST(Power, TooLargeThrows)
+{
+  bool threw = false;
+  try { (void)Pow(Small(3), (ULong)1 << 40); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
@@ -1,9 +1,12 @@
 #include "unit_test_framework.h"
 
 #include <random>
+#include <stdexcept>
 #include <vector>
 
 #include "biginteger/BigInteger.h"
+#include "biginteger/algorithms/Multiplication.h"
+#include "biginteger/algorithms/multiplication/NTTMultiplication.h"
 #include "biginteger/common/Comparator.h"
 #include "biginteger/ops/Division.h"
 #include "biginteger/ops/Multiplication.h"
@@ -59,6 +62,24 @@ REGISTER_TEST(PreparedAPI, ReusedMultiplyPreservesSign)
   }
 }
 
+REGISTER_TEST(PreparedAPI, MultiplyIntoReusesResultStorage)
+{
+  std::mt19937_64 gen(0xA111C0E0);
+  std::vector<DataT> fixed = RandomLimbs(600, gen);
+  auto prepared = NTTMultiplication::PrepareOperand(fixed, 700, BigInteger::Base());
+  std::vector<DataT> result;
+  result.reserve(1302);
+  const DataT *storage = result.data();
+
+  for (SizeT otherLimbs : {SizeT{700}, SizeT{300}, SizeT{699}})
+  {
+    std::vector<DataT> other = RandomLimbs(otherLimbs, gen);
+    NTTMultiplication::MultiplyInto(prepared, other.data(), otherLimbs, result);
+    ASSERT_EQ(Compare(result, Multiply(fixed, other, BigInteger::Base())), 0);
+    ASSERT_TRUE(result.data() == storage);
+  }
+}
+
 REGISTER_TEST(CachedAPI, ReusedDivisionMatchesDispatcher)
 {
   std::mt19937_64 gen(0xBADC0DE);
@@ -72,6 +93,7 @@ REGISTER_TEST(CachedAPI, ReusedDivisionMatchesDispatcher)
     auto actual = cached.DivideAndRemainder(dividend);
     ASSERT_EQ(actual.first.CompareTo(expected.first), 0);
     ASSERT_EQ(actual.second.CompareTo(expected.second), 0);
+    ASSERT_EQ(cached.Remainder(dividend).CompareTo(expected.second), 0);
   }
 }
 
@@ -88,6 +110,59 @@ REGISTER_TEST(CachedAPI, ReusedDivisionPreservesSign)
     auto actual = cached.DivideAndRemainder(dividend);
     ASSERT_EQ(actual.first.CompareTo(expected.first), 0);
     ASSERT_EQ(actual.second.CompareTo(expected.second), 0);
+    ASSERT_EQ(cached.Remainder(dividend).CompareTo(expected.second), 0);
   }
 }
 
+REGISTER_TEST(CachedAPI, SerializedDivisionMatchesOriginal)
+{
+  std::mt19937_64 gen(0xBADC0E0);
+  // The 2600-limb divisor is in the NTT range, so the spectra are stored.
+  for (SizeT divisorLimbs : {SizeT{1}, SizeT{40}, SizeT{2600}})
+  {
+    BigInteger divisor = RandomInteger(divisorLimbs, gen, divisorLimbs == 40);
+    CachedDivision cached(divisor);
+    BigInteger dividend = RandomInteger(3 * divisorLimbs + 7, gen, true);
+    auto expected = cached.DivideAndRemainder(dividend);
+
+    for (bool transforms : {false, true})
+    {
+      std::vector<uint8_t> blob = cached.Serialize(transforms);
+      ASSERT_EQ(blob.size() % 8, 0u);
+      CachedDivision loaded = CachedDivision::Deserialize(blob);
+      ASSERT_EQ(loaded.Divisor().CompareTo(divisor), 0);
+      auto actual = loaded.DivideAndRemainder(dividend);
+      ASSERT_EQ(actual.first.CompareTo(expected.first), 0);
+      ASSERT_EQ(actual.second.CompareTo(expected.second), 0);
+    }
+    if (divisorLimbs >= 2600)
+      ASSERT_LT(cached.Serialize(false).size(), cached.Serialize(true).size());
+    else
+      ASSERT_EQ(cached.Serialize(false).size(), cached.Serialize(true).size());
+  }
+}
+
+REGISTER_TEST(CachedAPI, SerializedDivisionRejectsBadBlobs)
+{
+  std::mt19937_64 gen(0xBADC0E1);
+  std::vector<uint8_t> blob = CachedDivision(RandomInteger(64, gen)).Serialize();
+
+  auto rejects = [](std::vector<uint8_t> const &bytes)
+  {
+    bool threw = false;
+    try { (void)CachedDivision::Deserialize(bytes); } catch (std::invalid_argument const &) { threw = true; }
+    return threw;
+  };
+
+  ASSERT_TRUE(rejects(std::vector<uint8_t>()));
+  ASSERT_TRUE(rejects(std::vector<uint8_t>(blob.begin(), blob.end() - 8)));
+  std::vector<uint8_t> bad = blob;
+  bad[0] = 'X';
+  ASSERT_TRUE(rejects(bad));
+  bad = blob;
+  bad[4] ^= 0xFF; // version
+  ASSERT_TRUE(rejects(bad));
+  bad = blob;
+  bad[24] ^= 1; // shift
+  ASSERT_TRUE(rejects(bad));
+}
@@ -0,0 +1,94 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/ops/Primality.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Power.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+using bigmath_ut::Small;
+
+namespace
+{
+  bool NaiveIsPrime(ULong n)
+  {
+    if (n < 2)
+      return false;
+    for (ULong p = 2; p * p <= n; ++p)
+      if (n % p == 0)
+        return false;
+    return true;
+  }
+
+  BigInteger Mersenne(ULong p)
+  {
+    return Pow(Small(2), p) - Small(1);
+  }
+}
+
+REGISTER_TEST(Primality, SmallValues)
+{
+  ASSERT_FALSE(IsProbablePrime(Small(0)));
+  ASSERT_FALSE(IsProbablePrime(Small(1)));
+  ASSERT_TRUE(IsProbablePrime(Small(2)));
+  ASSERT_TRUE(IsProbablePrime(Small(3)));
+  ASSERT_FALSE(IsProbablePrime(Small(4)));
+  ASSERT_FALSE(IsProbablePrime(BigIntegerBuilder::From("-7")));
+}
+
+REGISTER_TEST(Primality, MatchesTrialDivision)
+{
+  // Below the squared trial bound the sieve decides; above it BPSW does.
+  for (ULong n = 0; n < 20000; ++n)
+    ASSERT_EQ(IsProbablePrime(Small(n)), NaiveIsPrime(n));
+  ULong above = (ULong)BIGMATH_PRIMALITY_TRIAL_BOUND * BIGMATH_PRIMALITY_TRIAL_BOUND;
+  for (ULong n = above - 1000; n < above + 3000; ++n)
+    ASSERT_EQ(IsProbablePrime(Small(n)), NaiveIsPrime(n));
+}
+
+REGISTER_TEST(Primality, MersenneNumbers)
+{
+  ASSERT_TRUE(IsProbablePrime(Mersenne(521)));
+  ASSERT_TRUE(IsProbablePrime(Mersenne(607), 4));
+  ASSERT_TRUE(IsProbablePrime(Mersenne(1279)));
+  // 2^1277 − 1 is composite with no known factor.
+  ASSERT_FALSE(IsProbablePrime(Mersenne(1277)));
+  ASSERT_FALSE(IsProbablePrime(Mersenne(523)));
+}
+
+REGISTER_TEST(Primality, PseudoprimesRejected)
+{
+  // Strong pseudoprime to every prime base up to 23, no factor below 10^5.
+  ASSERT_FALSE(IsProbablePrime(BigIntegerBuilder::From("3825123056546413051")));
+  // Carmichael number.
+  ASSERT_FALSE(IsProbablePrime(Small(41041)));
+  // Product of two large primes.
+  ASSERT_FALSE(IsProbablePrime(Mersenne(61) * Mersenne(89)));
+  ASSERT_FALSE(IsProbablePrime(Mersenne(521) * Mersenne(607)));
+}
+
+REGISTER_TEST(Primality, BatchMatchesSerial)
+{
+  BigInteger base = Pow(Small(2), 200);
+  vector<BigInteger> candidates;
+  for (ULong k = 0; k < 300; ++k)
+    candidates.push_back(base + Small(k));
+  vector<bool> batch = IsProbablePrime(candidates, 2);
+  ASSERT_EQ(batch.size(), candidates.size());
+  SizeT primes = 0;
+  for (SizeT i = 0; i < candidates.size(); ++i)
+  {
+    ASSERT_EQ(batch[i], IsProbablePrime(candidates[i]));
+    primes += batch[i];
+  }
+  // 2^200 + 235 is the only prime in range.
+  ASSERT_TRUE(batch[235]);
+  ASSERT_EQ(primes, (SizeT)1);
+  ASSERT_TRUE(IsProbablePrime(vector<BigInteger>{}).empty());
+}
@@ -0,0 +1,186 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Division.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/ProductTree.h"
+#include "biginteger/ops/ScalarDivision.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+using bigmath_ut::RandomLimbs;
+using bigmath_ut::Small;
+
+namespace
+{
+  std::vector<DataT> SmallPrimes(SizeT count)
+  {
+    std::vector<DataT> primes;
+    for (DataT n = 2; primes.size() < count; ++n)
+    {
+      bool prime = true;
+      for (DataT p : primes)
+      {
+        if (p * p > n)
+          break;
+        if (n % p == 0)
+        {
+          prime = false;
+          break;
+        }
+      }
+      if (prime)
+        primes.push_back(n);
+    }
+    return primes;
+  }
+
+  // Pairwise coprime multi-limb moduli: disjoint groups of small primes.
+  std::vector<BigInteger> CoprimeModuli(SizeT count, SizeT primesEach)
+  {
+    std::vector<DataT> primes = SmallPrimes(count * primesEach);
+    std::vector<BigInteger> moduli;
+    for (SizeT i = 0; i < count; ++i)
+    {
+      BigInteger m = Small(1);
+      for (SizeT j = 0; j < primesEach; ++j)
+        m = m * Small(primes[i * primesEach + j]);
+      moduli.push_back(m);
+    }
+    return moduli;
+  }
+
+  // Floor remainder in [0, m).
+  BigInteger Mod(BigInteger const &x, BigInteger const &m)
+  {
+    BigInteger r = x % m;
+    if (r.IsNegative())
+      r = r + m;
+    return r;
+  }
+}
+
+REGISTER_TEST(ProductTree, LevelsAndProduct)
+{
+  RandomGenerator gen(1);
+  for (SizeT k : {1, 2, 3, 7, 64, 100})
+  {
+    std::vector<BigInteger> leaves;
+    BigInteger product = Small(1);
+    for (SizeT i = 0; i < k; ++i)
+    {
+      leaves.push_back(RandomLimbs(1 + i % 5, gen));
+      product = product * leaves.back();
+    }
+    ProductTree tree(leaves);
+    ASSERT_EQ(tree.Product().CompareTo(product), 0);
+    ASSERT_EQ(tree.Level(tree.Depth() - 1).size(), (size_t)1);
+    ASSERT_EQ(tree.Leaves().size(), (size_t)k);
+  }
+  bool threw = false;
+  try { ProductTree tree(std::vector<BigInteger>{}); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+REGISTER_TEST(ProductTree, RemaindersMatchDivision)
+{
+  RandomGenerator gen(2);
+  std::vector<BigInteger> moduli;
+  for (SizeT i = 0; i < 300; ++i)
+    moduli.push_back(RandomLimbs(1 + i % 9, gen) + Small(1));
+  RemainderTree tree(moduli);
+
+  // x below, around and far above the product of the moduli.
+  SizeT productLimbs = (SizeT)tree.Tree().Product().GetInteger().size();
+  for (SizeT limbs : {(SizeT)1, productLimbs / 2, productLimbs, 3 * productLimbs})
+  {
+    BigInteger x = RandomLimbs(limbs, gen);
+    for (bool negative : {false, true})
+    {
+      BigInteger v = negative && !x.Zero() ? Small(0) - x : x;
+      std::vector<BigInteger> r = tree.Remainders(v);
+      ASSERT_EQ(r.size(), moduli.size());
+      for (SizeT i = 0; i < moduli.size(); ++i)
+        ASSERT_EQ(r[i].CompareTo(Mod(v, moduli[i])), 0);
+    }
+  }
+  // Product above NEWTON_MEDIUM_B: the top nodes use cached reciprocals.
+  std::vector<BigInteger> wide;
+  for (SizeT i = 0; i < 40; ++i)
+    wide.push_back(RandomLimbs(130, gen) + Small(1));
+  RemainderTree big(wide);
+  BigInteger x = RandomLimbs(2 * (SizeT)big.Tree().Product().GetInteger().size() + 5, gen);
+  std::vector<BigInteger> r = big.Remainders(x);
+  for (SizeT i = 0; i < wide.size(); ++i)
+    ASSERT_EQ(r[i].CompareTo(x % wide[i]), 0);
+
+  bool threw = false;
+  try { RemainderTree zero({Small(3), Small(0)}); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+REGISTER_TEST(ProductTree, RemaindersOfLimbModuli)
+{
+  // Single-limb moduli: the lower levels reduce in one pass per node.
+  RandomGenerator gen(5);
+  std::vector<BigInteger> moduli;
+  std::vector<DataT> limbs;
+  for (SizeT i = 0; i < 1000; ++i)
+  {
+    limbs.push_back(i % 3 == 0 ? LimbMask - (DataT)i : (DataT)((gen.Next() & LimbMask) >> (i % 50)) | 1);
+    moduli.push_back(Small(limbs.back()));
+  }
+  RemainderTree tree(moduli);
+
+  for (SizeT n : {(SizeT)1, (SizeT)100, (SizeT)3000})
+  {
+    BigInteger x = RandomLimbs(n, gen);
+    for (bool negative : {false, true})
+    {
+      BigInteger v = negative ? Small(0) - x : x;
+      std::vector<BigInteger> r = tree.Remainders(v);
+      std::vector<DataT> flat = RemaindersMod(v, limbs);
+      for (SizeT i = 0; i < moduli.size(); ++i)
+      {
+        ASSERT_EQ(r[i].CompareTo(Mod(v, moduli[i])), 0);
+        ASSERT_EQ(r[i].CompareTo(Small(flat[i])), 0);
+      }
+    }
+  }
+}
+
+REGISTER_TEST(ProductTree, FromResiduesRoundTrip)
+{
+  RandomGenerator gen(3);
+  for (SizeT count : {1, 2, 5, 200})
+  {
+    for (SizeT primesEach : {1, 6})
+    {
+      RemainderTree tree(CoprimeModuli(count, primesEach));
+      BigInteger M = tree.Tree().Product();
+      BigInteger x = Mod(RandomLimbs((SizeT)M.GetInteger().size(), gen), M);
+      ASSERT_EQ(tree.FromResidues(tree.Remainders(x)).CompareTo(x), 0);
+    }
+  }
+
+  // Residues outside [0, m) are reduced first.
+  RemainderTree tree({Small(3), Small(5), Small(7)});
+  BigInteger x = tree.FromResidues({Small(0) - Small(1), Small(13), Small(2)});
+  ASSERT_EQ(x.CompareTo(Small(23)), 0);
+  bool threw = false;
+  try { (void)tree.FromResidues({Small(1), Small(2)}); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+REGISTER_TEST(ProductTree, FromResiduesNeedsCoprimeModuli)
+{
+  RemainderTree tree({Small(6), Small(35), Small(10)});
+  bool threw = false;
+  try { (void)tree.FromResidues({Small(1), Small(2), Small(3)}); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
@@ -0,0 +1,94 @@
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/common/Random.h"
+#include "biginteger/ops/Bitwise.h"
+#include "biginteger/ops/Random.h"
+
+using namespace BigMath;
+
+REGISTER_TEST(Random, NextAndFillShareSequence)
+{
+  RandomGenerator a(42), b(42);
+  vector<DataT> filled(37);
+  b.Next();
+  b.Fill(filled.data(), 2);
+  b.Fill(filled.data() + 2, (SizeT)filled.size() - 2);
+  a.Next();
+  for (DataT limb : filled)
+    ASSERT_EQ(a.Next() & LimbMask, limb);
+
+  // Different seeds and streams diverge.
+  ASSERT_NE(RandomGenerator(1).Next(), RandomGenerator(2).Next());
+  ASSERT_NE(RandomGenerator(1).Split(0).Next(), RandomGenerator(1).Split(1).Next());
+  ASSERT_EQ(RandomGenerator(1).Split(5).Next(), RandomGenerator(1).Split(5).Next());
+}
+
+REGISTER_TEST(Random, BitsInRange)
+{
+  RandomGenerator rng(7);
+  for (ULong bits : {0, 1, 63, 64, 65, 1000})
+  {
+    ULong longest = 0;
+    for (int trial = 0; trial < 50; ++trial)
+    {
+      BigInteger r = RandomBits(bits, rng);
+      ASSERT_FALSE(r.IsNegative());
+      ASSERT_TRUE(BitLength(r) <= bits);
+      longest = std::max(longest, BitLength(r));
+    }
+    // The top bit turns up about half the time.
+    ASSERT_EQ(longest, bits);
+  }
+}
+
+REGISTER_TEST(Random, BelowIsUniform)
+{
+  RandomGenerator rng(11);
+  vector<SizeT> counts(6, 0);
+  for (int trial = 0; trial < 6000; ++trial)
+  {
+    BigInteger r = RandomBelow(BigIntegerBuilder::From((ULong)6), rng);
+    counts[r.GetInteger()[0]]++;
+  }
+  for (SizeT c : counts)
+  {
+    ASSERT_GT(c, (SizeT)850);
+    ASSERT_LT(c, (SizeT)1150);
+  }
+
+  // Just above a power of two: most top-limb draws are rejected.
+  BigInteger bound = BigIntegerBuilder::From("340282366920938463463374607431768211457");
+  for (int trial = 0; trial < 200; ++trial)
+    ASSERT_LT(RandomBelow(bound, rng).CompareTo(bound), 0);
+
+  bool threw = false;
+  try
+  {
+    RandomBelow(BigInteger(), rng);
+  }
+  catch (std::invalid_argument const &)
+  {
+    threw = true;
+  }
+  ASSERT_TRUE(threw);
+}
+
+REGISTER_TEST(Random, SeededBitsAreBlockwise)
+{
+  ULong bits = (ULong)LimbBits * (2 * BIGMATH_RANDOM_BLOCK + 100) + 3;
+  BigInteger r = RandomBits(bits, (ULong)99);
+  ASSERT_EQ(r.CompareTo(RandomBits(bits, (ULong)99)), 0);
+  ASSERT_TRUE(BitLength(r) <= bits);
+
+  // Block 1 is stream 1 of the seed, independent of how blocks were scheduled.
+  vector<DataT> block(BIGMATH_RANDOM_BLOCK);
+  RandomGenerator(99).Split(1).Fill(block.data(), (SizeT)block.size());
+  for (SizeT i = 0; i < block.size(); ++i)
+    ASSERT_EQ(r.GetInteger()[BIGMATH_RANDOM_BLOCK + i], block[i]);
+}
@@ -0,0 +1,126 @@
+#include "unit_test_framework.h"
+#include "unit_test_random.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/ops/Addition.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Root.h"
+#include "biginteger/ops/Subtraction.h"
+
+using namespace BigMath;
+using bigmath_ut::RandomLimbs;
+using bigmath_ut::Small;
+
+namespace
+{
+  BigInteger Power(BigInteger const &x, SizeT k)
+  {
+    BigInteger r = Small(1);
+    for (SizeT i = 0; i < k; ++i)
+      r = r * x;
+    return r;
+  }
+
+  // x^k ≤ a < (x + 1)^k and remainder = a − x^k.
+  void CheckRoot(BigInteger const &a, SizeT k)
+  {
+    BigInteger r;
+    BigInteger x = RootRem(a, k, r);
+    ASSERT_EQ((Power(x, k) + r).CompareTo(a), 0);
+    ASSERT_FALSE(r.IsNegative());
+    ASSERT_TRUE(Power(x + Small(1), k).CompareTo(a) > 0);
+  }
+}
+
+REGISTER_TEST(Root, SqrtSmallValues)
+{
+  for (DataT v = 0; v < 2000; ++v)
+  {
+    BigInteger r;
+    BigInteger s = SqrtRem(Small(v), r);
+    DataT e = 0;
+    while ((e + 1) * (e + 1) <= v)
+      ++e;
+    ASSERT_EQ(s.CompareTo(Small(e)), 0);
+    ASSERT_EQ(r.CompareTo(Small(v - e * e)), 0);
+  }
+}
+
+REGISTER_TEST(Root, SqrtAcrossSizes)
+{
+  // Odd and even limb counts, unnormalized tops, and the recursion bands.
+  RandomGenerator gen(0x5047);
+  for (SizeT n : {SizeT{1}, SizeT{2}, SizeT{3}, SizeT{4}, SizeT{7}, SizeT{33}, SizeT{200}, SizeT{1501}})
+    for (int trial = 0; trial < 3; ++trial)
+    {
+      BigInteger a = RandomLimbs(n, gen);
+      BigInteger r;
+      BigInteger s = SqrtRem(a, r);
+      ASSERT_EQ((s * s + r).CompareTo(a), 0);
+      ASSERT_FALSE(r.IsNegative());
+      ASSERT_TRUE(r.CompareTo(s + s) <= 0);
+    }
+}
+
+REGISTER_TEST(Root, SqrtPerfectSquaresAndNeighbours)
+{
+  RandomGenerator gen(0x5048);
+  for (SizeT n : {SizeT{1}, SizeT{5}, SizeT{64}, SizeT{300}})
+  {
+    BigInteger x = RandomLimbs(n, gen);
+    BigInteger sq = x * x;
+    BigInteger r;
+    ASSERT_EQ(SqrtRem(sq, r).CompareTo(x), 0);
+    ASSERT_TRUE(r.Zero());
+    // (x + 1)² − 1 still has root x, with the largest remainder 2x.
+    BigInteger below = (x + Small(1)) * (x + Small(1)) - Small(1);
+    ASSERT_EQ(SqrtRem(below, r).CompareTo(x), 0);
+    ASSERT_EQ(r.CompareTo(x + x), 0);
+    ASSERT_EQ(Sqrt(sq - Small(1)).CompareTo(x - Small(1)), 0);
+  }
+}
+
+REGISTER_TEST(Root, KthRootAcrossSizes)
+{
+  RandomGenerator gen(0x5049);
+  for (SizeT k : {SizeT{1}, SizeT{3}, SizeT{4}, SizeT{5}, SizeT{17}, SizeT{64}})
+    for (SizeT n : {SizeT{1}, SizeT{3}, SizeT{40}, SizeT{150}})
+      CheckRoot(RandomLimbs(n, gen) + Small(1), k);
+}
+
+REGISTER_TEST(Root, KthRootOfExactPowers)
+{
+  RandomGenerator gen(0x504A);
+  for (SizeT k : {SizeT{3}, SizeT{7}})
+  {
+    BigInteger x = RandomLimbs(20, gen);
+    BigInteger p = Power(x, k);
+    BigInteger r;
+    ASSERT_EQ(RootRem(p, k, r).CompareTo(x), 0);
+    ASSERT_TRUE(r.Zero());
+    ASSERT_EQ(Root(p - Small(1), k).CompareTo(x - Small(1)), 0);
+  }
+  // Degree far above the bit length.
+  ASSERT_EQ(Root(Small(1000), 100000).CompareTo(Small(1)), 0);
+}
+
+REGISTER_TEST(Root, NegativeOperands)
+{
+  BigInteger r;
+  BigInteger x = RootRem(Small(30).SetSign(true), 3, r);
+  ASSERT_EQ(x.CompareTo(Small(3).SetSign(true)), 0);
+  ASSERT_EQ(r.CompareTo(Small(3).SetSign(true)), 0);
+
+  bool threw = false;
+  try { (void)Sqrt(Small(4).SetSign(true)); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+  threw = false;
+  try { (void)Root(Small(16).SetSign(true), 4); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+  threw = false;
+  try { (void)Root(Small(16), 0); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
@@ -1,13 +1,19 @@
 // BigInteger << / >> operate at LIMB granularity (base-2^32), not bit.
 // So  a << k  ≡  a · (2^32)^k  and  a >> k ≡ a / (2^32)^k.
+// ShiftLeftBits / ShiftRightBits are the bit-granular shifts.
 
 #include "unit_test_framework.h"
 
+#include <random>
+#include <vector>
+
 #include "biginteger/BigInteger.h"
 #include "biginteger/common/Builder.h"
 #include "biginteger/common/Parser.h"
 #include "biginteger/ops/Comparison.h"
+#include "biginteger/ops/Division.h"
 #include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Power.h"
 #include "biginteger/ops/Shift.h"
 
 using namespace BigMath;
@@ -107,3 +113,43 @@ REGISTER_TEST(Shift, SignPreserved)
   ASSERT_TRUE(s.IsNegative());
   ASSERT_EQ(s >> 2, a);
 }
+
+REGISTER_TEST(Shift, BitsMatchPowersOfTwo)
+{
+  BigInteger a = BigIntegerBuilder::From("-123456789012345678901234567890123");
+  BigInteger two = BigIntegerBuilder::From("2");
+  for (ULong bits : {0, 1, 7, 31, 32, 33, 63, 64, 65, 100, 128, 200})
+  {
+    BigInteger p = Pow(two, bits);
+    ASSERT_EQ(ShiftLeftBits(a, bits), a * p);
+    ASSERT_EQ(ShiftRightBits(a, bits), a / p);
+    ASSERT_EQ(ShiftRightBits(ShiftLeftBits(a, bits), bits), a);
+  }
+  ASSERT_TRUE(ShiftRightBits(a, 1000).Zero());
+  ASSERT_EQ(ShiftLeftLimbs(a, 3), a << 3);
+  ASSERT_EQ(ShiftRightLimbs(a, 1), a >> 1);
+}
+
+REGISTER_TEST(Shift, InPlaceMatchesCopy)
+{
+  std::mt19937_64 gen(0x5417ULL);
+  for (SizeT n : {1, 2, 3, 17, 64})
+  {
+    std::vector<DataT> v(n);
+    for (DataT &x : v)
+      x = gen() & LimbMask;
+    for (ULong bits = 0; bits < 3 * LimbBits + 5; ++bits)
+    {
+      std::vector<DataT> l = v, r = v;
+      ShiftLeftBitsTo(l, bits);
+      ShiftRightBitsTo(r, bits);
+      ASSERT_TRUE(l == ShiftLeftBits(v, bits));
+      ASSERT_TRUE(r == ShiftRightBits(v, bits));
+      ASSERT_EQ(BitLength(l), BitLength(v) + (SizeT)bits);
+      ShiftRightBitsTo(l, bits);
+      std::vector<DataT> t = v;
+      TrimZerosToOne(t);
+      ASSERT_TRUE(l == t);
+    }
+  }
+}
@@ -3,16 +3,21 @@
 
 #include "unit_test_framework.h"
 
+#include <cstring>
 #include <random>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "biginteger/BigInteger.h"
+#include "biginteger/algorithms/BaseConversion.h"
 #include "biginteger/common/Builder.h"
 #include "biginteger/common/Parser.h"
 #include "biginteger/ops/Comparison.h"
 #include "biginteger/ops/IO.h"
+#include "biginteger/ops/Multiplication.h"
+#include "biginteger/ops/Addition.h"
 
 using namespace BigMath;
 
@@ -105,6 +110,44 @@ REGISTER_TEST(Parse, EighteenDigitChunkBoundary)
   }
 }
 
+// ParseChunk takes 16 or eight digits per step after the leading len % 8.
+REGISTER_TEST(Parse, ChunkMatchesDigitByDigit)
+{
+  std::mt19937 gen(0xA0);
+  std::uniform_int_distribution<int> digit(0, 9);
+  for (SizeT len = 1; len <= 19; ++len)
+  {
+    for (int trial = 0; trial < 20; ++trial)
+    {
+      std::string s;
+      for (SizeT i = 0; i < len; ++i)
+        s.push_back(trial == 0 ? '9' : trial == 1 ? '0' : (char)('0' + digit(gen)));
+      std::string padded = "x" + s + "yyyyyyyyyyyyyyyy";
+      ASSERT_EQ(ParseChunk(padded.c_str(), 1, len), std::stoull(s));
+    }
+  }
+}
+
+// Digits are validated in blocks of 8, 16 and 32; every stop position and
+// every kind of non-digit byte has to end the number, also past the
+// terminator search window.
+REGISTER_TEST(Parse, StopsAtEveryOffset)
+{
+  std::mt19937 gen(0xA1);
+  for (int len : {1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 64, 65, 4095, 4096, 4097, 9000})
+  {
+    std::string digits = RandomDigits(len, gen);
+    BigInteger expected = Parse(digits.c_str());
+    for (char stop : {'/', ':', ' ', '\x80', '\xb0', '\xff'})
+    {
+      std::string text = digits + stop + RandomDigits(40, gen);
+      Int processed = 0;
+      ASSERT_EQ(Parse(text.c_str(), &processed), expected);
+      ASSERT_EQ(processed, len);
+    }
+  }
+}
+
 // ─── ToString basics ─────────────────────────────────────────────────────────
 
 REGISTER_TEST(ToString, ZeroIsZero)
@@ -171,6 +214,31 @@ REGISTER_TEST(IO, IstreamRoundTrip)
   ASSERT_EQ(parsed, original);
 }
 
+// operator>> parses 8192-digit blocks and merges them pairwise; lengths
+// around whole blocks, zero blocks and the text after the number.
+REGISTER_TEST(IO, IstreamBlocks)
+{
+  std::mt19937 gen(0xA2);
+  for (int len : {8191, 8192, 8193, 2 * 8192, 3 * 8192 + 5, 40000})
+  {
+    std::string digits = RandomDigits(len, gen);
+    std::istringstream is("  -000" + digits + " tail");
+    BigInteger parsed;
+    is >> parsed;
+    ASSERT_EQ(parsed, Parse(("-" + digits).c_str()));
+    std::string rest;
+    is >> rest;
+    ASSERT_EQ(rest, "tail");
+  }
+
+  std::string power = "1" + std::string(3 * 8192, '0');
+  std::istringstream is(power);
+  BigInteger parsed;
+  is >> parsed;
+  ASSERT_EQ(ToString(parsed), power);
+  ASSERT_TRUE(is.eof());
+}
+
 // ─── Pow10 sanity ────────────────────────────────────────────────────────────
 
 REGISTER_TEST(Pow10, SmallPowers)
@@ -191,3 +259,192 @@ REGISTER_TEST(Pow10, LargePowerMatchesString)
   std::string expected1000 = "1" + std::string(1000, '0');
   ASSERT_EQ(ToString(Pow10(1000)), expected1000);
 }
+
+// ─── power-of-two radixes ────────────────────────────────────────────────────
+
+REGISTER_TEST(Pow2Radix, KnownValues)
+{
+  ASSERT_EQ(ToHex(Parse("3735928559")), "deadbeef");
+  ASSERT_EQ(ToHex(Parse("-255")), "-ff");
+  ASSERT_EQ(ToBinary(Parse("10")), "1010");
+  ASSERT_EQ(ToHex(BigInteger()), "0");
+  ASSERT_EQ(ToBinary(BigInteger()), "0");
+  ASSERT_EQ(ToStringPow2(Parse("123456789012345678901234567890"), 8), "143564417755415637016711617605322");
+  ASSERT_EQ(ToStringPow2(Parse("123456789012345678901234567890"), 32), "33n91vrc6sv0tp73u2mi");
+
+  ASSERT_EQ(ParseHex("DeadBeef"), Parse("3735928559"));
+  ASSERT_EQ(ParseHex("-000ff"), Parse("-255"));
+  ASSERT_EQ(BigIntegerBuilder::FromBinary("+1010"), Parse("10"));
+  ASSERT_EQ(BigIntegerBuilder::FromRadix("777", 8), Parse("511"));
+  ASSERT_TRUE(ParseHex("").Zero());
+  ASSERT_TRUE(ParseHex("000").Zero());
+
+  Int processed = 0;
+  ASSERT_EQ(ParseHex("1fg", &processed), Parse("31"));
+  ASSERT_EQ(processed, 2);
+  ASSERT_EQ(ParseBinary("-1012", &processed), Parse("-5"));
+  ASSERT_EQ(processed, 4);
+  // Stops inside an eight-digit block at the first character that is not a digit.
+  for (char stop : {'/', ':', '@', 'G', '`', 'g', '\x80'})
+  {
+    std::string text = "123456789ABCDEF" + std::string(1, stop) + "12345678";
+    ASSERT_EQ(ParseHex(text.c_str(), &processed), ParseHex("123456789abcdef"));
+    ASSERT_EQ(processed, 15);
+  }
+  ASSERT_EQ(ParseBinary("1010101010101010120", &processed), ParseBinary("10101010101010101"));
+  ASSERT_EQ(processed, 17);
+
+  bool threw = false;
+  try { (void)ToStringPow2(Parse("10"), 10); } catch (std::invalid_argument const &) { threw = true; }
+  ASSERT_TRUE(threw);
+}
+
+// Every radix and every length around the packed word sizes against
+// multiply-and-add, then back to the same (lower-case) digits.
+REGISTER_TEST(Pow2Radix, MatchesMultiplyAdd)
+{
+  std::mt19937 gen(0x9A);
+  char const *alphabet = "0123456789abcdefghijklmnopqrstuv";
+  for (SizeT radix : {2u, 4u, 8u, 16u, 32u})
+  {
+    for (int len : {1, 7, 8, 9, 31, 32, 33, 64, 100, 257})
+    {
+      std::uniform_int_distribution<SizeT> digit(0, radix - 1);
+      std::string digits;
+      BigInteger expected;
+      BigInteger r = BigIntegerBuilder::From((ULong)radix);
+      for (int i = 0; i < len; ++i)
+      {
+        SizeT d = i == 0 ? 1 + digit(gen) % (radix - 1) : digit(gen);
+        digits.push_back(alphabet[d]);
+        expected = expected * r + BigIntegerBuilder::From((ULong)d);
+      }
+      std::string upper = digits;
+      for (char &c : upper)
+        c = (char)std::toupper((unsigned char)c);
+
+      ASSERT_EQ(ParseRadixPow2(digits.c_str(), radix), expected);
+      ASSERT_EQ(ParseRadixPow2(upper.c_str(), radix), expected);
+      ASSERT_EQ(ToStringPow2(expected, radix), digits);
+    }
+  }
+}
+
+REGISTER_TEST(Pow2Radix, LargeRoundTrip)
+{
+  std::mt19937 gen(0x9B);
+  BigInteger x = Parse(RandomDigits(20000, gen).c_str());
+  ASSERT_EQ(ParseHex(ToHex(x).c_str()), x);
+  ASSERT_EQ(ParseBinary(ToBinary(x).c_str()), x);
+  ASSERT_EQ(ToHex(x).size(), (ToBinary(x).size() + 3) / 4);
+}
+
+// ConvertBase between power-of-two bases repacks bits; nibbles in base 16
+// are the hex digits read from the end.
+REGISTER_TEST(Pow2Radix, ConvertBaseRepacks)
+{
+  std::mt19937 gen(0x9C);
+  BigInteger x = Parse(RandomDigits(700, gen).c_str());
+  std::string hex = ToHex(x);
+  std::vector<DataT> nibbles = ConvertBase(x.GetInteger(), CurrentBase, Base16);
+  ASSERT_EQ(nibbles.size(), hex.size());
+  for (size_t i = 0; i < hex.size(); ++i)
+    ASSERT_EQ(nibbles[i], (DataT)std::stoi(std::string(1, hex[hex.size() - 1 - i]), nullptr, 16));
+
+  std::vector<DataT> back = ConvertBase(ConvertBase(nibbles, Base16, Base2_8), Base2_8, CurrentBase);
+  ASSERT_EQ(Compare(back, x.GetInteger()), 0);
+}
+
+// ─── any radix ───────────────────────────────────────────────────────────────
+
+REGISTER_TEST(Radix, KnownValues)
+{
+  ASSERT_EQ(ToStringRadix(Parse("35"), 36), "z");
+  ASSERT_EQ(ToStringRadix(Parse("36"), 36), "10");
+  ASSERT_EQ(ToStringRadix(Parse("35"), 62), "Z");
+  ASSERT_EQ(ToStringRadix(Parse("-61"), 62), "-z");
+  ASSERT_EQ(ToStringRadix(BigInteger(), 7), "0");
+  ASSERT_EQ(ToStringRadix(Parse("123456789012345678901234567890"), 36), "byw97um9s91dlz68tsi");
+  ASSERT_EQ(ToStringRadix(Parse("-123456789012345678901234567890"), 10), "-123456789012345678901234567890");
+  ASSERT_EQ(ToStringRadix(Parse("255"), 16), "ff");
+
+  ASSERT_EQ(ParseRadix("ZZ", 36), Parse("1295"));
+  ASSERT_EQ(ParseRadix("zz", 36), Parse("1295"));
+  ASSERT_EQ(ParseRadix("Zz", 62), Parse("2231"));
+  ASSERT_EQ(ParseRadix("-0012", 3), Parse("-5"));
+  ASSERT_EQ(BigIntegerBuilder::FromRadix("byw97um9s91dlz68tsi", 36), Parse("123456789012345678901234567890"));
+  ASSERT_TRUE(ParseRadix("", 62).Zero());
+
+  Int processed = 0;
+  ASSERT_EQ(ParseRadix("1239", 7, &processed), Parse("66"));
+  ASSERT_EQ(processed, 3);
+  ASSERT_EQ(ParseRadix("+zA!", 36, &processed), Parse("1270"));
+  ASSERT_EQ(processed, 3);
+
+  for (SizeT radix : {0u, 1u, 63u})
+  {
+    bool threw = false;
+    try { (void)ToStringRadix(Parse("10"), radix); } catch (std::invalid_argument const &) { threw = true; }
+    ASSERT_TRUE(threw);
+    threw = false;
+    try { (void)ParseRadix("10", radix); } catch (std::invalid_argument const &) { threw = true; }
+    ASSERT_TRUE(threw);
+  }
+}
+
+// Random digits on both sides of the chunk sizes and of the (scaled) D&C
+// thresholds, against multiply-and-add eight digits at a time.
+REGISTER_TEST(Radix, MatchesMultiplyAdd)
+{
+  std::mt19937 gen(0x9D);
+  char const *lower = "0123456789abcdefghijklmnopqrstuvwxyz";
+  char const *mixed = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+  for (SizeT radix : {3u, 7u, 36u, 37u, 62u})
+  {
+    char const *alphabet = radix <= 36 ? lower : mixed;
+    ULong radix8 = 1;
+    for (int i = 0; i < 8; ++i)
+      radix8 *= radix;
+    for (int len : {1, 9, 10, 11, 40, 1500, 6000, 40000})
+    {
+      if (len == 40000 && radix != 3)
+        continue;
+      std::uniform_int_distribution<SizeT> digit(0, radix - 1);
+      std::string digits;
+      for (int i = 0; i < len; ++i)
+        digits.push_back(alphabet[i == 0 ? 1 + digit(gen) % (radix - 1) : digit(gen)]);
+
+      BigInteger expected;
+      for (int i = 0; i < len;)
+      {
+        int n = i == 0 && len % 8 != 0 ? len % 8 : 8;
+        ULong chunk = 0, scale = 1;
+        for (int j = 0; j < n; ++j, ++i)
+        {
+          chunk = chunk * radix + (ULong)(std::strchr(alphabet, digits[i]) - alphabet);
+          scale *= radix;
+        }
+        expected = expected * BigIntegerBuilder::From(scale) + BigIntegerBuilder::From(chunk);
+      }
+
+      ASSERT_EQ(ParseRadix(digits.c_str(), radix), expected);
+      ASSERT_EQ(ToStringRadix(expected, radix), digits);
+    }
+  }
+}
+
+// ConvertBase between the limb base and a radix ≤ 62 yields the radix digits
+// from the low end.
+REGISTER_TEST(Radix, ConvertBaseUsesRadixDigits)
+{
+  std::mt19937 gen(0x9E);
+  BigInteger x = Parse(RandomDigits(3000, gen).c_str());
+  for (SizeT radix : {10u, 36u, 62u})
+  {
+    std::vector<DataT> digits = ConvertBase(x.GetInteger(), CurrentBase, radix);
+    ASSERT_EQ(digits.size(), ToStringRadix(x, radix).size());
+    ASSERT_EQ(ToStringRadix(std::vector<DataT>{digits.front()}, radix),
+              ToStringRadix(x, radix).substr(digits.size() - 1));
+    ASSERT_EQ(Compare(ConvertBase(digits, radix, CurrentBase), x.GetInteger()), 0);
+  }
+}
@@ -0,0 +1,38 @@
+// Operands shared by the unit tests. Random limbs come from RandomBits
+// (ops/Random.h), so every test draws from the library's own generator.
+
+#ifndef BIGMATH_UNIT_TEST_RANDOM_H
+#define BIGMATH_UNIT_TEST_RANDOM_H
+
+#include "biginteger/BigInteger.h"
+#include "biginteger/common/Builder.h"
+#include "biginteger/common/Random.h"
+#include "biginteger/ops/Bitwise.h"
+#include "biginteger/ops/Random.h"
+
+namespace bigmath_ut
+{
+  // x as a BigInteger, built the way the baseline tests build literals.
+  inline BigMath::BigInteger Small(BigMath::ULong x)
+  {
+    return BigMath::BigIntegerBuilder::From(x);
+  }
+
+  // Uniform in [0, B^limbs). With topBit the top bit is set as well, so the
+  // value has exactly `limbs` limbs.
+  inline BigMath::BigInteger RandomLimbs(BigMath::SizeT limbs, BigMath::RandomGenerator &rng,
+                                         bool topBit = false)
+  {
+    BigMath::ULong bits = (BigMath::ULong)limbs * BigMath::LimbBits;
+    BigMath::BigInteger r = BigMath::RandomBits(bits, rng);
+    return topBit && bits > 0 ? BigMath::SetBit(r, bits - 1) : r;
+  }
+
+  // Odd with the top bit set: a full-length odd modulus or operand.
+  inline BigMath::BigInteger RandomOdd(BigMath::SizeT limbs, BigMath::RandomGenerator &rng)
+  {
+    return BigMath::SetBit(RandomLimbs(limbs, rng, true), 0);
+  }
+}
+
+#endif